@@ -0,0 +1,233 @@
+#include <FastLED.h>
+#include "Config.h"
+#include "Leds.h"
+#include "Bench.h"
+
+#if USE_BENCH
+#include "Background.h"
+#include "ScenarioCloud.h"
+#include "ScenarioWaves.h"
+#include "ScenarioWorms.h"
+#include "ScenarioSmiley.h"
+#include "ScenarioFire.h"
+#include "ScenarioAudio.h"
+#include "Effects.h"
+
+#if defined(__AVR__)
+  #include <avr/sleep.h>
+#endif
+
+// ScenarioStream (Serial) n'est pas mesuré : il partage le port du banc. ScenarioAudio l'est
+// sans son échantillonneur (Timer1/ADC, pris par le banc) : analyse seule sur un bloc fixe.
+#define BENCH_CASE(n) (BENCH_ONLY == 0 || BENCH_ONLY == (n))
+
+// ===== Cas =====
+#if BENCH_CASE(1)
+// Fond seul : même boucle que main.ino en mode BACKGROUND_ONLY
+class BenchBackground : public Scenario {
+public:
+  void begin() override { backgroundBegin(); }
+  void tick(uint32_t now) override {
+    backgroundTick(now);
+    for (int i = 0; i < NUM_LEDS; ++i) {
+      uint8_t v = backgroundGet(i);
+      leds[i] = CRGB(v, v, v);
+    }
+    ledsShow();
+  }
+};
+static BenchBackground scBackground;
+static const char N_BACKGROUND[] PROGMEM = "Background";
+#endif
+#if BENCH_CASE(2)
+static ScenarioCloud  scCloud;
+static const char N_CLOUD[] PROGMEM = "Cloud";
+#endif
+#if BENCH_CASE(3)
+static ScenarioWaves  scWaves;
+static const char N_WAVES[] PROGMEM = "Waves";
+#endif
+#if BENCH_CASE(4)
+static ScenarioWorms  scWorms;
+static const char N_WORMS[] PROGMEM = "Worms";
+#endif
+#if BENCH_CASE(5)
+static ScenarioSmiley scSmiley;
+static const char N_SMILEY[] PROGMEM = "Smiley";
+#endif
+#if BENCH_CASE(6)
+static ScenarioFire   scFire;
+static const char N_FIRE[] PROGMEM = "Fire";
+#endif
+#if BENCH_CASE(7)
+static ScenarioEffect<FX_RIPPLES> scRipples;   // même forme que Waves, en déclaratif
+static const char N_RIPPLES[] PROGMEM = "Ripples";
+#endif
+#if BENCH_CASE(8)
+class BenchAudio : public Scenario {
+public:
+  void begin() override { audioBenchBegin(); }
+  void tick(uint32_t now) override { (void)now; audioBenchTick(); }
+};
+static BenchAudio scAudio;
+static const char N_AUDIO[] PROGMEM = "Audio";
+// un bloc analysé toutes les AUDIO_FFT_N / MIC_SAMPLE_HZ s
+static constexpr uint32_t AUDIO_BUDGET = (uint32_t)(F_CPU / MIC_SAMPLE_HZ) * AUDIO_FFT_N;
+#endif
+
+struct BenchCase { const char* name; Scenario* sc; uint32_t budget; };   // budget 0 = aucun
+static const BenchCase cases[] = {
+#if BENCH_CASE(1)
+  { N_BACKGROUND, &scBackground, 0 },
+#endif
+#if BENCH_CASE(2)
+  { N_CLOUD,      &scCloud,      0 },
+#endif
+#if BENCH_CASE(3)
+  { N_WAVES,      &scWaves,      0 },
+#endif
+#if BENCH_CASE(4)
+  { N_WORMS,      &scWorms,      0 },
+#endif
+#if BENCH_CASE(5)
+  { N_SMILEY,     &scSmiley,     0 },
+#endif
+#if BENCH_CASE(6)
+  { N_FIRE,       &scFire,       0 },
+#endif
+#if BENCH_CASE(7)
+  { N_RIPPLES,    &scRipples,    0 },
+#endif
+#if BENCH_CASE(8)
+  { N_AUDIO,      &scAudio,      AUDIO_BUDGET },
+#endif
+};
+static const uint8_t NUM_CASES = sizeof(cases)/sizeof(cases[0]);
+
+// ===== Compteur de cycles, pile, RAM =====
+#if defined(__AVR__)
+static volatile uint16_t cycHi = 0;
+ISR(TIMER1_OVF_vect) { cycHi++; }
+
+static void cyclesBegin() {
+  TCCR1A = 0;
+  TCCR1B = _BV(CS10);                     // horloge CPU, sans prédiviseur
+  TCNT1  = 0;
+  TIFR1  = _BV(TOV1);
+  TIMSK1 = _BV(TOIE1);
+}
+
+static uint32_t cycles() {
+  noInterrupts();
+  uint16_t lo = TCNT1;
+  uint16_t hi = cycHi;
+  if ((TIFR1 & _BV(TOV1)) && lo < 0x8000) hi++;   // débordement pas encore servi
+  interrupts();
+  return ((uint32_t)hi << 16) | lo;
+}
+
+extern char __data_start, __bss_end;
+extern char* __brkval;
+static constexpr uint8_t PAINT = 0xC5;
+
+static char* stackFloor() { return __brkval ? __brkval : &__bss_end; }
+
+// Peint la zone libre entre le tas et la pile courante
+static void __attribute__((noinline)) stackPaint() {
+  char* top = (char*)SP - 16;
+  for (char* p = stackFloor(); p < top; ++p) *p = PAINT;
+}
+
+static uint16_t stackHighWater() {
+  char* p = stackFloor();
+  while (p <= (char*)RAMEND && (uint8_t)*p == PAINT) ++p;
+  return (uint16_t)((char*)RAMEND - p + 1);
+}
+
+static uint16_t staticRam() { return (uint16_t)(&__bss_end - &__data_start); }
+
+// Les ticks sont mesurés IRQ actives (millis() doit avancer) : les cycles incluent l'ISR
+// Timer0 de millis() (~1 par ms) et celle de débordement Timer1 (1 / 65536 cycles).
+// Estimation de leur part : même boucle mesurée IRQ coupées (< 1 débordement), puis 16 fois
+// IRQ actives. Résultat en pour mille, affiché à titre indicatif (non retranché).
+static void __attribute__((noinline)) busyLoop() {
+  for (volatile uint16_t i = 0; i < 2000; ++i) {}
+}
+
+static uint16_t isrLoadPermille() {
+  noInterrupts();
+  uint16_t a = TCNT1;
+  busyLoop();
+  uint16_t quiet = TCNT1 - a;
+  interrupts();
+
+  uint32_t t0 = cycles();
+  for (uint8_t k = 0; k < 16; ++k) busyLoop();
+  uint32_t busy = cycles() - t0;
+  uint32_t ref  = (uint32_t)quiet * 16;
+  return (busy > ref) ? (uint16_t)(((busy - ref) * 1000) / busy) : 0;
+}
+#else
+// Hors AVR : approximation via micros(), pas de mesure de pile ni de RAM
+static void cyclesBegin() {}
+static uint32_t cycles() { return micros() * (F_CPU / 1000000UL); }
+static void stackPaint() {}
+static uint16_t stackHighWater() { return 0; }
+static uint16_t staticRam() { return 0; }
+static uint16_t isrLoadPermille() { return 0; }
+#endif
+
+// ===== Public API =====
+void benchRun() {
+  Serial.begin(BENCH_BAUD);
+  ledsBegin();
+  cyclesBegin();
+
+  // coût de la mesure elle-même, retranché de chaque tick
+  uint32_t c0 = cycles();
+  uint32_t overhead = cycles() - c0;
+
+  Serial.print(F("# ticks="));      Serial.print((uint32_t)BENCH_TICKS);
+  Serial.print(F(" static_ram="));  Serial.print((uint32_t)staticRam());
+  Serial.print(F(" isr_permille=")); Serial.println((uint32_t)isrLoadPermille());
+  Serial.flush();                           // l'ISR USART TX ne doit pas tomber dans les mesures
+
+  for (uint8_t c = 0; c < NUM_CASES; ++c) {
+    Scenario* sc = cases[c].sc;
+    FastLED.clear();
+    stackPaint();
+    sc->begin();
+
+    uint32_t sum = 0, lo = 0xFFFFFFFFUL, hi = 0;
+    for (uint16_t n = 0; n < BENCH_TICKS; ++n) {
+      uint32_t now = millis();
+      uint32_t t0 = cycles();
+      sc->tick(now);
+      uint32_t dt = cycles() - t0 - overhead;
+      sum += dt;
+      if (dt < lo) lo = dt;
+      if (dt > hi) hi = dt;
+    }
+    sc->end();
+    uint16_t stack = stackHighWater();      // avant tout appel Serial : sa pile fausserait la mesure
+
+    Serial.print((const __FlashStringHelper*)cases[c].name);
+    Serial.print(F(" cyc_avg=")); Serial.print(sum / BENCH_TICKS);
+    Serial.print(F(" cyc_min=")); Serial.print(lo);
+    Serial.print(F(" cyc_max=")); Serial.print(hi);
+    if (cases[c].budget) {
+      Serial.print(F(" budget="));  Serial.print(cases[c].budget);
+    }
+    Serial.print(F(" stack="));   Serial.println((uint32_t)stack);
+    Serial.flush();
+  }
+  Serial.println(F("# done"));
+  Serial.flush();
+
+  #if defined(__AVR__)
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    noInterrupts();
+    sleep_mode();                           // simavr (-m atmega2560) : fin de simulation
+  #endif
+}
+#endif
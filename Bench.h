@@ -0,0 +1,15 @@
+#pragma once
+#include <Arduino.h>
+#include "Config.h"
+
+// Banc de mesure (USE_BENCH) : exécute BENCH_TICKS ticks de chaque scénario et affiche
+// sur Serial les cycles par tick, la pile maximale et la RAM statique (.data + .bss).
+// Sur AVR les cycles sont comptés par Timer1 à F_CPU, IRQ actives : ils incluent les ISR
+// de fond (millis(), débordement Timer1), dont la part est affichée (isr_permille) ;
+// la sortie série est vidée avant chaque cas. Sous simavr le programme s'arrête de lui-même
+// à la fin (sommeil IRQ coupées).
+//
+// Cible : ATmega2560 (Mega, 8 Ko de RAM ; simavr -m atmega2560 -f 16000000). Les 2 Ko d'un
+// ATmega328P ne suffisent pas pour tous les cas réunis. host/bench_images.sh construit une
+// image par cas (BENCH_ONLY = 1..n) et donne la RAM statique de chacune.
+void benchRun();
@@ -9,7 +9,37 @@
 
 #define PIN_BUTTON      5
 
+#define PIN_MIC         A1         // micro analogique (sortie centrée sur VCC/2)
+#define MIC_SAMPLE_HZ   6400       // cadence d'échantillonnage -> 100 Hz par bin (FFT 64 points)
+#define MIC_ADC_BITS    10         // résolution de analogRead() sur la carte
+
 // === Global options ===
 #define USE_COLOR_TEMP  1
 #define COLOR_TEMP      Candle     // Candle, Tungsten40W, Halogen, Neutral, Daylight, Overcast, ClearBlueSky
 #define USE_VIDEO_DITHER 1
+#define SMILEY_DRIFT    0          // 1 = démo sprite : le smiley se balance et respire (sous-LED)
+
+// === Streaming série (ScenarioStream, protocole type Adalight) ===
+#define USE_STREAM        0        // 1 = scénario "stream" dans la rotation (reste noir sans hôte)
+#define STREAM_BAUD       500000
+#define STREAM_TIMEOUT_MS 100      // trame incomplète abandonnée après ce silence
+#define STREAM_STATS_MS   1000     // période du rapport "#fps= drop=" (0 = désactivé)
+#if defined(__AVR__)
+  #define STREAM_WINDOW   1        // FastLED.show() coupe les IRQ : pas de trame en vol pendant l'affichage
+#else
+  #define STREAM_WINDOW   3        // trames que l'hôte peut envoyer sans attendre de crédit
+#endif
+
+// === Aperçu d'effets déclaratifs (ScenarioEffectPreview, EffectSpec.h) ===
+#define USE_FX_PREVIEW    0        // 1 = scénario "aperçu" dans la rotation : EffectDesc reçu en texte sur le port série
+#define FX_PREVIEW_BAUD   115200
+
+// === Banc de mesure (Bench.cpp) : remplace setup()/loop(), sortie FastLED neutralisée ===
+#ifndef USE_BENCH                  // surchargeables en ligne de commande (-DUSE_BENCH=1 -DBENCH_ONLY=n)
+  #define USE_BENCH       0
+#endif
+#define BENCH_TICKS       200      // ticks mesurés par scénario (<= 1000)
+#define BENCH_BAUD        115200
+#ifndef BENCH_ONLY
+  #define BENCH_ONLY      0        // 0 = tous ; n = seul le cas n (RAM statique de ce scénario seul)
+#endif
@@ -0,0 +1,54 @@
+#pragma once
+#include <Arduino.h>
+
+// Pool d'effets à taille fixe : acquire()/release() en O(1), parcours limité aux effets vivants.
+//
+// Disposition hybride, volontairement pas en struct-of-arrays complet : l'état commun (instant
+// de départ, permutation des slots) est en tableaux séparés, la charge utile T reste un
+// tableau de structs. Les T actuels font 2 à 4 octets et sont toujours lus en entier par
+// l'effet qui les possède ; sur AVR (ni cache ni SIMD) les éclater ne change pas le coût
+// d'accès et imposerait un pool par champ. À revoir si un scénario parcourt un seul champ.
+// _slots[] est une permutation des slots : [0, _live) = vivants, [_live, N) = liste libre ;
+// _pos[] donne la position inverse.
+//
+// Parcours avec libération en cours de route : itérer à rebours
+//   for (uint8_t k = pool.size(); k-- > 0;) { uint8_t s = pool.slotAt(k); ... pool.release(s); }
+// release() ne déplace que des slots déjà visités.
+template <typename T, uint8_t N>
+class EffectPool {
+  static_assert(N > 0, "EffectPool: N doit être > 0");
+public:
+  void clear() {
+    for (uint8_t i = 0; i < N; ++i) { _slots[i] = i; _pos[i] = i; }
+    _live = 0;
+  }
+
+  // Renvoie le slot réservé (charge utile remise à zéro), ou -1 si le pool est plein
+  int16_t acquire(uint32_t start) {
+    if (_live >= N) return -1;
+    uint8_t s = _slots[_live++];
+    _start[s] = start;
+    _data[s]  = T{};
+    return s;
+  }
+
+  void release(uint8_t s) {
+    uint8_t p    = _pos[s];
+    uint8_t last = _slots[--_live];
+    _slots[p] = last;   _pos[last] = p;
+    _slots[_live] = s;  _pos[s] = _live;
+  }
+
+  uint8_t  size() const              { return _live; }
+  bool     full() const              { return _live >= N; }
+  uint8_t  slotAt(uint8_t k) const   { return _slots[k]; }
+  uint32_t start(uint8_t s) const    { return _start[s]; }
+  T&       operator[](uint8_t s)     { return _data[s]; }
+
+private:
+  T        _data[N];
+  uint32_t _start[N];
+  uint8_t  _slots[N];
+  uint8_t  _pos[N];
+  uint8_t  _live = 0;
+};
@@ -0,0 +1,117 @@
+#include "EffectSpec.h"
+
+uint8_t fxTarget[NUM_LEDS];
+uint8_t fxSmooth[NUM_LEDS];
+
+void fxBaseBegin(const EffectDesc& d) {
+  if (d.base == FxBase::BACKGROUND) backgroundBegin();
+}
+
+void fxSpawn(const EffectDesc& d, FxInst& fx) {
+  fx.seed = random(NUM_LEDS);
+  fx.dir  = random(6);
+  const Axial a = hexCoord(fx.seed);
+
+  uint8_t reach = 0;
+  switch (d.field) {
+    case FxField::POINT:
+      break;
+    case FxField::RAY:
+      while (hexValid(a.q + (reach + 1) * HEX_DIRS[fx.dir][0], a.r + (reach + 1) * HEX_DIRS[fx.dir][1])) reach++;
+      break;
+    case FxField::RADIAL:
+      // la LED la plus éloignée d'une graine est toujours l'un des 6 coins
+      for (uint8_t i = 0; i < 6; ++i) {
+        const Axial c = { (int8_t)(HEX_R * HEX_DIRS[i][0]), (int8_t)(HEX_R * HEX_DIRS[i][1]) };
+        uint8_t dist = hexDistance(a, c);
+        if (dist > reach) reach = dist;
+      }
+      break;
+  }
+  fx.reach = reach;
+}
+
+void fxScheduleNext(const EffectDesc& d, uint32_t now) {
+  uint16_t span = (d.waitMaxMs > d.waitMinMs) ? d.waitMaxMs - d.waitMinMs : 0;
+  spawnWheel.schedule(now + d.waitMinMs + random(span + 1), SPAWN_FX);
+}
+
+// ===== Version interprétée =====
+static constexpr uint8_t FX_DESC_FIELDS = 15;
+
+// Lit jusqu'à count entiers décimaux non signés séparés par des blancs ; false si la ligne
+// n'en contient pas exactement count ou si une valeur dépasse 65535
+static bool parseFields(const char* p, uint16_t* out, uint8_t count) {
+  uint8_t n = 0;
+  for (;;) {
+    while (*p == ' ' || *p == '\t' || *p == '\r') ++p;
+    if (*p == 0) return n == count;
+    if (*p < '0' || *p > '9' || n >= count) return false;
+    uint32_t v = 0;
+    while (*p >= '0' && *p <= '9') {
+      v = v * 10 + (*p++ - '0');
+      if (v > 0xFFFF) return false;
+    }
+    out[n++] = (uint16_t)v;
+  }
+}
+
+static bool parseDesc(const char* line, EffectDesc& d) {
+  uint16_t v[FX_DESC_FIELDS];
+  if (!parseFields(line, v, FX_DESC_FIELDS)) return false;
+  if (v[0] > (uint8_t)FxField::RADIAL || v[2] > (uint8_t)FxCurve::SMOOTH ||
+      v[6] > (uint8_t)FxBase::NOISE   || v[9] > (uint8_t)FxBlend::ADD) return false;
+  static const uint8_t BYTE_FIELDS[] = { 5, 7, 8, 10, 11, 12 };   // peak, baseMin/Max, attack, decay, slots
+  for (uint8_t k = 0; k < sizeof(BYTE_FIELDS); ++k) if (v[BYTE_FIELDS[k]] > 255) return false;
+  if (v[7] > v[8]) return false;                                         // baseMin <= baseMax
+  if (v[12] == 0 || v[12] > ScenarioEffectPreview::MAX_SLOTS) return false;
+  if (v[0] != (uint8_t)FxField::POINT && v[1] == 0) return false;
+  if (v[3] + v[4] == 0 || (uint32_t)v[3] + v[4] > 0xFFFF) return false;   // span sur 16 bits
+
+  d = EffectDesc{
+    (FxField)v[0], v[1],
+    (FxCurve)v[2], v[3], v[4], (uint8_t)v[5],
+    (FxBase)v[6], (uint8_t)v[7], (uint8_t)v[8],
+    (FxBlend)v[9],
+    (uint8_t)v[10], (uint8_t)v[11],
+    (uint8_t)v[12], v[13], v[14]
+  };
+  return true;
+}
+
+void ScenarioEffectPreview::setDesc(const EffectDesc& d) {
+  _desc = d;
+  fxBegin(_desc, _pool);
+}
+
+void ScenarioEffectPreview::begin() {
+  Serial.begin(FX_PREVIEW_BAUD);
+  _len = 0;
+  fxBegin(_desc, _pool);
+}
+
+// Sans jamais bloquer : accumule la ligne en cours, l'applique à '\n'
+void ScenarioEffectPreview::pumpSerial() {
+  while (Serial.available() > 0) {
+    char c = (char)Serial.read();
+    if (c != '\n') {
+      if (_len < LINE_MAX - 1) _line[_len] = c;
+      if (_len < LINE_MAX) _len++;            // LINE_MAX = ligne trop longue, rejetée
+      continue;
+    }
+    bool ok = false;
+    if (_len < LINE_MAX) {
+      _line[_len] = 0;
+      EffectDesc d;
+      ok = parseDesc(_line, d);
+      if (ok) setDesc(d);
+    }
+    _len = 0;
+    Serial.print(ok ? F("ok\n") : F("err\n"));
+  }
+}
+
+void ScenarioEffectPreview::tick(uint32_t now) {
+  pumpSerial();
+  fxTick(_desc, _pool, now);
+}
@@ -0,0 +1,231 @@
+#pragma once
+#include <FastLED.h>
+#include "Config.h"
+#include "Leds.h"
+#include "Background.h"
+#include "Scenario.h"
+#include "EffectPool.h"
+#include "SpawnWheel.h"
+#include "HexRaster.h"
+
+// Effets déclaratifs : un EffectDesc décrit un look (forme spatiale + enveloppe + fond/mélange
+// + lissage + spawns) à la manière de Cloud/Waves/Worms, sans écrire de boucle tick().
+//
+//   ScenarioEffect<DESC>   : DESC (constexpr) en paramètre de template -> les champs sont des
+//                            constantes que le compilateur peut replier (switch de forme, courbe,
+//                            mélange et fond hors des boucles). Restent des branches par
+//                            échantillon : montée/descente de fxEnvelope, test hors grille de
+//                            hexForRing. Aucune mesure AVR ne compare encore ce rendu à un
+//                            tick() écrit à la main (banc : Ripples = cas 7, Waves = cas 3).
+//   ScenarioEffectPreview  : interprète la même description à l'exécution ; une nouvelle
+//                            description arrive par le port série (USE_FX_PREVIEW), sans reflasher.
+//
+// Temps local d'une LED : tau = t - distance * stepMs (distance = 0 pour POINT, pas le long du
+// rayon pour RAY, anneau hex autour de la graine pour RADIAL). L'enveloppe monte sur riseMs puis
+// descend sur fallMs ; seules les LEDs dont tau tombe dans [0, riseMs + fallMs) sont visitées.
+
+enum class FxField : uint8_t { POINT, RAY, RADIAL };
+enum class FxCurve : uint8_t { LINEAR, QUAD, SMOOTH };
+enum class FxBase  : uint8_t { NONE, BACKGROUND, NOISE };
+enum class FxBlend : uint8_t { MAX, ADD };
+
+struct EffectDesc {
+  // forme spatiale
+  FxField  field;
+  uint16_t stepMs;       // propagation : ms par pas de distance (RAY, RADIAL)
+  // enveloppe
+  FxCurve  curve;
+  uint16_t riseMs;
+  uint16_t fallMs;
+  uint8_t  peak;
+  // fond + mélange
+  FxBase   base;
+  uint8_t  baseMin;      // NOISE : lueur min/max (baseMin <= baseMax) ; échelle et vitesse du
+  uint8_t  baseMax;      //         bruit fixes (FX_NOISE_*), comme le fond de Worms
+  FxBlend  blend;
+  // lissage EMA asymétrique (attack == 0 -> aucun)
+  uint8_t  attack;
+  uint8_t  decay;
+  // spawns
+  uint8_t  slots;        // effets simultanés max
+  uint16_t waitMinMs;    // waitMaxMs == 0 -> slots toujours pleins (relance immédiate, phases
+                         //                   étalées au démarrage)
+  uint16_t waitMaxMs;
+};
+
+struct FxInst {
+  uint8_t seed = 0;
+  uint8_t dir = 0;       // RAY : 0..5
+  uint8_t reach = 0;     // distance max atteignable depuis la graine
+};
+
+// Tampons partagés (un seul scénario actif à la fois)
+extern uint8_t fxTarget[NUM_LEDS];
+extern uint8_t fxSmooth[NUM_LEDS];
+
+void    fxBaseBegin(const EffectDesc& d);
+void    fxSpawn(const EffectDesc& d, FxInst& fx);
+void    fxScheduleNext(const EffectDesc& d, uint32_t now);
+
+#define FX_INLINE static inline __attribute__((always_inline))
+
+// Fond NOISE : non réglables par EffectDesc (la ligne série garde ses 15 champs)
+static constexpr uint8_t  FX_NOISE_SCALE    = 13;   // pas spatial entre LEDs voisines
+static constexpr uint16_t FX_NOISE_SPEED_MS = 45;   // ms par pas temporel
+
+FX_INLINE uint8_t fxEnvelope(const EffectDesc& d, int32_t tau) {
+  if (tau < 0 || tau >= (int32_t)d.riseMs + d.fallMs) return 0;
+  uint8_t u = (tau < d.riseMs)
+            ? (uint8_t)(((uint32_t)tau * 255) / d.riseMs)
+            : (uint8_t)(255 - ((uint32_t)(tau - d.riseMs) * 255) / d.fallMs);
+  switch (d.curve) {
+    case FxCurve::LINEAR: break;
+    case FxCurve::QUAD:   u = scale8(u, u); break;
+    case FxCurve::SMOOTH: u = ease8InOutCubic(u); break;
+  }
+  return (uint8_t)(((uint16_t)d.peak * (u + 1)) >> 8);
+}
+
+FX_INLINE void fxBlend(const EffectDesc& d, int idx, uint8_t v) {
+  if (d.blend == FxBlend::MAX) { if (v > fxTarget[idx]) fxTarget[idx] = v; }
+  else                         fxTarget[idx] = qadd8(fxTarget[idx], v);
+}
+
+FX_INLINE void fxBase(const EffectDesc& d, uint32_t now) {
+  switch (d.base) {
+    case FxBase::NONE:
+      for (int i = 0; i < NUM_LEDS; ++i) fxTarget[i] = 0;
+      break;
+    case FxBase::BACKGROUND:
+      backgroundTick(now);
+      for (int i = 0; i < NUM_LEDS; ++i) fxTarget[i] = backgroundGet(i);
+      break;
+    case FxBase::NOISE:
+      for (int i = 0; i < NUM_LEDS; ++i) {
+        uint8_t n = inoise8(i * FX_NOISE_SCALE, now / FX_NOISE_SPEED_MS);
+        fxTarget[i] = d.baseMin + (((uint16_t)(d.baseMax - d.baseMin) * n) >> 8);
+      }
+      break;
+  }
+}
+
+// Rend un effet à l'instant local t ; false quand il est terminé
+FX_INLINE bool fxRender(const EffectDesc& d, const FxInst& fx, uint32_t t) {
+  const uint32_t span = (uint32_t)d.riseMs + d.fallMs;
+  if (d.field == FxField::POINT) {
+    if (t >= span) return false;
+    fxBlend(d, fx.seed, fxEnvelope(d, (int32_t)t));
+    return true;
+  }
+
+  const uint16_t step = d.stepMs ? d.stepMs : 1;
+  if (t >= (uint32_t)fx.reach * step + span) return false;
+
+  // fenêtre des distances dont le temps local est dans [0, span)
+  uint16_t kMin = (t >= span) ? (uint16_t)((t - span) / step) : 0;
+  uint16_t kMax = (uint16_t)(t / step);
+  if (kMax > fx.reach) kMax = fx.reach;
+
+  const Axial a = hexCoord(fx.seed);
+  for (uint16_t k = kMin; k <= kMax; ++k) {
+    uint8_t v = fxEnvelope(d, (int32_t)(t - (uint32_t)k * step));
+    if (v == 0) continue;
+    if (d.field == FxField::RAY) {
+      fxBlend(d, hexIndex(a.q + k * HEX_DIRS[fx.dir][0], a.r + k * HEX_DIRS[fx.dir][1]), v);
+    } else {
+      hexForRing(a.q, a.r, (uint8_t)k, [&](int idx, uint8_t) { fxBlend(d, idx, v); });
+    }
+  }
+  return true;
+}
+
+FX_INLINE void fxOutput(const EffectDesc& d) {
+  for (int i = 0; i < NUM_LEDS; ++i) {
+    uint8_t v = fxTarget[i];
+    if (d.attack) {
+      uint16_t s = fxSmooth[i];
+      uint16_t a = (v > s) ? d.attack : d.decay;
+      v = (uint8_t)(((s * (256 - a)) + ((uint16_t)v * a)) >> 8);
+      fxSmooth[i] = v;
+    }
+    leds[i] = CRGB(v, v, v);
+  }
+  ledsShow();
+}
+
+// Une trame complète ; Pool = EffectPool<FxInst, N>
+template <typename Pool>
+FX_INLINE void fxTick(const EffectDesc& d, Pool& pool, uint32_t now) {
+  fxBase(d, now);
+
+  if (d.waitMaxMs == 0) {
+    while (pool.size() < d.slots && !pool.full()) fxSpawn(d, pool[pool.acquire(now)]);
+  } else {
+    while (spawnWheel.poll(now) >= 0) {
+      if (pool.size() < d.slots && !pool.full()) fxSpawn(d, pool[pool.acquire(now)]);
+      fxScheduleNext(d, now);
+    }
+  }
+
+  for (uint8_t k = pool.size(); k-- > 0;) {
+    uint8_t s = pool.slotAt(k);
+    if (!fxRender(d, pool[s], now - pool.start(s))) pool.release(s);
+  }
+
+  fxOutput(d);
+}
+
+template <typename Pool>
+FX_INLINE void fxBegin(const EffectDesc& d, Pool& pool) {
+  randomSeed(analogRead(A0));
+  pool.clear();
+  for (int i = 0; i < NUM_LEDS; ++i) fxSmooth[i] = 0;
+  fxBaseBegin(d);
+  uint32_t now = millis();
+  spawnWheel.clear(now);
+  if (d.waitMaxMs != 0) {
+    fxScheduleNext(d, now);
+  } else {
+    // slots toujours pleins : départs étalés sur une enveloppe, sinon tous battent à l'unisson
+    const uint16_t span = d.riseMs + d.fallMs;
+    while (pool.size() < d.slots && !pool.full()) fxSpawn(d, pool[pool.acquire(now - random(span))]);
+  }
+}
+
+// ===== Version compilée =====
+template <const EffectDesc& D>
+class ScenarioEffect : public Scenario {
+  static_assert(D.slots > 0, "EffectDesc: slots doit être > 0");
+  static_assert(D.field == FxField::POINT || D.stepMs > 0, "EffectDesc: stepMs requis pour RAY/RADIAL");
+  static_assert(D.riseMs + D.fallMs > 0, "EffectDesc: enveloppe vide");
+  static_assert(D.baseMin <= D.baseMax, "EffectDesc: baseMin > baseMax");
+public:
+  void begin() override             { fxBegin(D, _pool); }
+  void tick(uint32_t now) override  { fxTick(D, _pool, now); }
+private:
+  EffectPool<FxInst, D.slots> _pool;
+};
+
+// ===== Version interprétée =====
+// Démarre sur la description passée au constructeur. Sur le port série (FX_PREVIEW_BAUD),
+// une ligne de 15 entiers dans l'ordre des champs d'EffectDesc remplace le look en cours :
+//   field stepMs curve riseMs fallMs peak base baseMin baseMax blend attack decay slots waitMin waitMax
+//   ex. Ripples : "2 140 2 250 900 200 1 0 0 0 220 80 4 800 3500"
+// Réponse "ok\n", ou "err\n" (ligne mal formée, valeur hors bornes) : le look reste inchangé.
+class ScenarioEffectPreview : public Scenario {
+public:
+  static constexpr uint8_t MAX_SLOTS = 32;
+  static constexpr uint8_t LINE_MAX  = 96;
+
+  explicit ScenarioEffectPreview(const EffectDesc& d) : _desc(d) {}
+  void setDesc(const EffectDesc& d);         // change de look et redémarre
+  void begin() override;
+  void tick(uint32_t now) override;
+private:
+  void pumpSerial();
+
+  EffectDesc _desc;
+  EffectPool<FxInst, MAX_SLOTS> _pool;
+  char    _line[LINE_MAX];
+  uint8_t _len = 0;
+};
@@ -0,0 +1,34 @@
+#pragma once
+#include "EffectSpec.h"
+
+// Bibliothèque de looks déclaratifs (voir EffectSpec.h)
+
+// Ronds dans l'eau : anneaux qui s'éloignent de la graine, sur le fond animé
+static constexpr EffectDesc FX_RIPPLES = {
+  FxField::RADIAL, 140,                 // forme, ms par anneau
+  FxCurve::SMOOTH, 250, 900, 200,       // courbe, montée, descente, crête
+  FxBase::BACKGROUND, 0, 0,             // fond
+  FxBlend::MAX,
+  220, 80,                              // lissage attack / decay
+  4, 800, 3500                          // slots, attente min / max
+};
+
+// Comètes : traits rapides le long des 6 directions, sur une lueur de bruit
+static constexpr EffectDesc FX_COMETS = {
+  FxField::RAY, 60,
+  FxCurve::QUAD, 80, 600, 230,
+  FxBase::NOISE, 4, 14,
+  FxBlend::MAX,
+  0, 0,                                 // pas de lissage : traits nets
+  12, 150, 600
+};
+
+// Scintillement : LEDs isolées qui s'allument et s'éteignent, nombre constant
+static constexpr EffectDesc FX_SPARKLE = {
+  FxField::POINT, 0,
+  FxCurve::SMOOTH, 300, 900, 200,
+  FxBase::NONE, 0, 0,
+  FxBlend::ADD,
+  220, 80,
+  24, 0, 0                              // toujours 24 actives
+};
@@ -0,0 +1,64 @@
+#include "HexGrid.h"
+
+static_assert(NUM_LEDS == 169, "HexGrid: tables calculées pour le hex R=7");
+
+const int8_t HEX_DIRS[6][2] = { {1,0},{1,-1},{0,-1},{-1,0},{-1,1},{0,1} };
+
+// premier index de chaque ligne r = -R..R
+static const uint8_t ROW_START[2*HEX_R+1] PROGMEM = {
+  0, 8, 17, 27, 38, 50, 63, 77, 92, 106, 119, 131, 142, 152, 161
+};
+
+// (q, r) de chaque LED, dans l'ordre du câblage
+static const int8_t COORDS[NUM_LEDS][2] PROGMEM = {
+  { 0,-7}, { 1,-7}, { 2,-7}, { 3,-7}, { 4,-7}, { 5,-7}, { 6,-7}, { 7,-7},
+  { 7,-6}, { 6,-6}, { 5,-6}, { 4,-6}, { 3,-6}, { 2,-6}, { 1,-6}, { 0,-6},
+  {-1,-6}, {-2,-5}, {-1,-5}, { 0,-5}, { 1,-5}, { 2,-5}, { 3,-5}, { 4,-5},
+  { 5,-5}, { 6,-5}, { 7,-5}, { 7,-4}, { 6,-4}, { 5,-4}, { 4,-4}, { 3,-4},
+  { 2,-4}, { 1,-4}, { 0,-4}, {-1,-4}, {-2,-4}, {-3,-4}, {-4,-3}, {-3,-3},
+  {-2,-3}, {-1,-3}, { 0,-3}, { 1,-3}, { 2,-3}, { 3,-3}, { 4,-3}, { 5,-3},
+  { 6,-3}, { 7,-3}, { 7,-2}, { 6,-2}, { 5,-2}, { 4,-2}, { 3,-2}, { 2,-2},
+  { 1,-2}, { 0,-2}, {-1,-2}, {-2,-2}, {-3,-2}, {-4,-2}, {-5,-2}, {-6,-1},
+  {-5,-1}, {-4,-1}, {-3,-1}, {-2,-1}, {-1,-1}, { 0,-1}, { 1,-1}, { 2,-1},
+  { 3,-1}, { 4,-1}, { 5,-1}, { 6,-1}, { 7,-1}, { 7, 0}, { 6, 0}, { 5, 0},
+  { 4, 0}, { 3, 0}, { 2, 0}, { 1, 0}, { 0, 0}, {-1, 0}, {-2, 0}, {-3, 0},
+  {-4, 0}, {-5, 0}, {-6, 0}, {-7, 0}, {-7, 1}, {-6, 1}, {-5, 1}, {-4, 1},
+  {-3, 1}, {-2, 1}, {-1, 1}, { 0, 1}, { 1, 1}, { 2, 1}, { 3, 1}, { 4, 1},
+  { 5, 1}, { 6, 1}, { 5, 2}, { 4, 2}, { 3, 2}, { 2, 2}, { 1, 2}, { 0, 2},
+  {-1, 2}, {-2, 2}, {-3, 2}, {-4, 2}, {-5, 2}, {-6, 2}, {-7, 2}, {-7, 3},
+  {-6, 3}, {-5, 3}, {-4, 3}, {-3, 3}, {-2, 3}, {-1, 3}, { 0, 3}, { 1, 3},
+  { 2, 3}, { 3, 3}, { 4, 3}, { 3, 4}, { 2, 4}, { 1, 4}, { 0, 4}, {-1, 4},
+  {-2, 4}, {-3, 4}, {-4, 4}, {-5, 4}, {-6, 4}, {-7, 4}, {-7, 5}, {-6, 5},
+  {-5, 5}, {-4, 5}, {-3, 5}, {-2, 5}, {-1, 5}, { 0, 5}, { 1, 5}, { 2, 5},
+  { 1, 6}, { 0, 6}, {-1, 6}, {-2, 6}, {-3, 6}, {-4, 6}, {-5, 6}, {-6, 6},
+  {-7, 6}, {-7, 7}, {-6, 7}, {-5, 7}, {-4, 7}, {-3, 7}, {-2, 7}, {-1, 7},
+  { 0, 7},
+};
+
+Axial hexCoord(uint8_t idx) {
+  Axial a;
+  a.q = (int8_t)pgm_read_byte(&COORDS[idx][0]);
+  a.r = (int8_t)pgm_read_byte(&COORDS[idx][1]);
+  return a;
+}
+
+int hexIndex(int q, int r) {
+  if (!hexValid(q, r)) return HEX_INVALID;
+  uint8_t row = r + HEX_R;
+  int q1 = max(-HEX_R, -r - HEX_R);
+  int q2 = min(HEX_R,  -r + HEX_R);
+  int off = (row & 1) ? (q2 - q) : (q - q1);   // serpentin
+  return pgm_read_byte(&ROW_START[row]) + off;
+}
+
+int hexNeighbor(int idx, uint8_t dir) {
+  const Axial a = hexCoord(idx);
+  return hexIndex((int)a.q + HEX_DIRS[dir][0], (int)a.r + HEX_DIRS[dir][1]);
+}
+
+uint8_t hexDistance(const Axial& a, const Axial& b) {
+  int dq = abs(a.q - b.q);
+  int dr = abs(a.r - b.r);
+  int ds = abs((a.q + a.r) - (b.q + b.r));
+  return (uint8_t)((dq + dr + ds) / 2);
+}
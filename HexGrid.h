@@ -0,0 +1,23 @@
+#pragma once
+#include <Arduino.h>
+#include "Config.h"
+
+// Grand hex en coordonnées axiales (q, r), rayon HEX_R (8 par côté -> R=7).
+// Câblage serpentin : lignes r = -R..R de haut en bas, q croissant, lignes impaires inversées.
+// Coordonnées en flash, index calculé : aucune table en RAM.
+static constexpr int HEX_R = 7;
+static constexpr int HEX_INVALID = -1;
+
+struct Axial { int8_t q, r; };
+
+// directions (axial) : E, NE, NW, W, SW, SE
+extern const int8_t HEX_DIRS[6][2];
+
+static inline bool hexValid(int q, int r) {
+  return (abs(q) <= HEX_R) && (abs(r) <= HEX_R) && (abs(q + r) <= HEX_R);
+}
+
+Axial   hexCoord(uint8_t idx);
+int     hexIndex(int q, int r);                 // HEX_INVALID hors grille
+int     hexNeighbor(int idx, uint8_t dir);      // HEX_INVALID hors grille
+uint8_t hexDistance(const Axial& a, const Axial& b);
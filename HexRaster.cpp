@@ -0,0 +1,218 @@
+#include "HexRaster.h"
+
+const uint16_t HEX_RING_START[HEX_RING_MAX + 2] PROGMEM = {
+  0, 1, 7, 19, 37, 61, 91, 127, 169, 217, 271, 331, 397, 469, 547, 631
+};
+
+// Anneaux concentriques : départ au coin SW, puis côtés E, NE, NW, W, SW, SE (k pas chacun).
+// Angle = direction euclidienne du centre de la LED (x = q + r/2, y = -r*sqrt(3)/2).
+const HexRingCell HEX_SPIRAL[] PROGMEM = {
+  // anneau 0
+  {  0,  0,  0},
+  // anneau 1
+  { -1,  1,171}, {  0,  1,213}, {  1,  0,  0}, {  1, -1, 43}, {  0, -1, 85}, { -1,  0,128},
+  // anneau 2
+  { -2,  2,171}, { -1,  2,192}, {  0,  2,213}, {  1,  1,235}, {  2,  0,  0}, {  2, -1, 21}, {  2, -2, 43}, {  1, -2, 64},
+  {  0, -2, 85}, { -1, -1,107}, { -2,  0,128}, { -2,  1,149},
+  // anneau 3
+  { -3,  3,171}, { -2,  3,184}, { -1,  3,200}, {  0,  3,213}, {  1,  2,227}, {  2,  1,242}, {  3,  0,  0}, {  3, -1, 14},
+  {  3, -2, 29}, {  3, -3, 43}, {  2, -3, 56}, {  1, -3, 72}, {  0, -3, 85}, { -1, -2, 99}, { -2, -1,114}, { -3,  0,128},
+  { -3,  1,142}, { -3,  2,157},
+  // anneau 4
+  { -4,  4,171}, { -3,  4,181}, { -2,  4,192}, { -1,  4,203}, {  0,  4,213}, {  1,  3,223}, {  2,  2,235}, {  3,  1,246},
+  {  4,  0,  0}, {  4, -1, 10}, {  4, -2, 21}, {  4, -3, 33}, {  4, -4, 43}, {  3, -4, 53}, {  2, -4, 64}, {  1, -4, 75},
+  {  0, -4, 85}, { -1, -3, 95}, { -2, -2,107}, { -3, -1,118}, { -4,  0,128}, { -4,  1,138}, { -4,  2,149}, { -4,  3,161},
+  // anneau 5
+  { -5,  5,171}, { -4,  5,178}, { -3,  5,187}, { -2,  5,197}, { -1,  5,206}, {  0,  5,213}, {  1,  4,221}, {  2,  3,230},
+  {  3,  2,239}, {  4,  1,248}, {  5,  0,  0}, {  5, -1,  8}, {  5, -2, 17}, {  5, -3, 26}, {  5, -4, 35}, {  5, -5, 43},
+  {  4, -5, 50}, {  3, -5, 59}, {  2, -5, 69}, {  1, -5, 78}, {  0, -5, 85}, { -1, -4, 93}, { -2, -3,102}, { -3, -2,111},
+  { -4, -1,120}, { -5,  0,128}, { -5,  1,136}, { -5,  2,145}, { -5,  3,154}, { -5,  4,163},
+  // anneau 6
+  { -6,  6,171}, { -5,  6,177}, { -4,  6,184}, { -3,  6,192}, { -2,  6,200}, { -1,  6,207}, {  0,  6,213}, {  1,  5,220},
+  {  2,  4,227}, {  3,  3,235}, {  4,  2,242}, {  5,  1,250}, {  6,  0,  0}, {  6, -1,  6}, {  6, -2, 14}, {  6, -3, 21},
+  {  6, -4, 29}, {  6, -5, 36}, {  6, -6, 43}, {  5, -6, 49}, {  4, -6, 56}, {  3, -6, 64}, {  2, -6, 72}, {  1, -6, 79},
+  {  0, -6, 85}, { -1, -5, 92}, { -2, -4, 99}, { -3, -3,107}, { -4, -2,114}, { -5, -1,122}, { -6,  0,128}, { -6,  1,134},
+  { -6,  2,142}, { -6,  3,149}, { -6,  4,157}, { -6,  5,164},
+  // anneau 7
+  { -7,  7,171}, { -6,  7,176}, { -5,  7,182}, { -4,  7,189}, { -3,  7,195}, { -2,  7,202}, { -1,  7,208}, {  0,  7,213},
+  {  1,  6,219}, {  2,  5,225}, {  3,  4,231}, {  4,  3,238}, {  5,  2,245}, {  6,  1,251}, {  7,  0,  0}, {  7, -1,  5},
+  {  7, -2, 11}, {  7, -3, 18}, {  7, -4, 25}, {  7, -5, 31}, {  7, -6, 37}, {  7, -7, 43}, {  6, -7, 48}, {  5, -7, 54},
+  {  4, -7, 61}, {  3, -7, 67}, {  2, -7, 74}, {  1, -7, 80}, {  0, -7, 85}, { -1, -6, 91}, { -2, -5, 97}, { -3, -4,103},
+  { -4, -3,110}, { -5, -2,117}, { -6, -1,123}, { -7,  0,128}, { -7,  1,133}, { -7,  2,139}, { -7,  3,146}, { -7,  4,153},
+  { -7,  5,159}, { -7,  6,165},
+  // anneau 8
+  { -8,  8,171}, { -7,  8,175}, { -6,  8,181}, { -5,  8,186}, { -4,  8,192}, { -3,  8,198}, { -2,  8,203}, { -1,  8,209},
+  {  0,  8,213}, {  1,  7,218}, {  2,  6,223}, {  3,  5,229}, {  4,  4,235}, {  5,  3,241}, {  6,  2,246}, {  7,  1,251},
+  {  8,  0,  0}, {  8, -1,  5}, {  8, -2, 10}, {  8, -3, 15}, {  8, -4, 21}, {  8, -5, 27}, {  8, -6, 33}, {  8, -7, 38},
+  {  8, -8, 43}, {  7, -8, 47}, {  6, -8, 53}, {  5, -8, 58}, {  4, -8, 64}, {  3, -8, 70}, {  2, -8, 75}, {  1, -8, 81},
+  {  0, -8, 85}, { -1, -7, 90}, { -2, -6, 95}, { -3, -5,101}, { -4, -4,107}, { -5, -3,113}, { -6, -2,118}, { -7, -1,123},
+  { -8,  0,128}, { -8,  1,133}, { -8,  2,138}, { -8,  3,143}, { -8,  4,149}, { -8,  5,155}, { -8,  6,161}, { -8,  7,166},
+  // anneau 9
+  { -9,  9,171}, { -8,  9,175}, { -7,  9,179}, { -6,  9,184}, { -5,  9,189}, { -4,  9,195}, { -3,  9,200}, { -2,  9,205},
+  { -1,  9,209}, {  0,  9,213}, {  1,  8,217}, {  2,  7,222}, {  3,  6,227}, {  4,  5,232}, {  5,  4,237}, {  6,  3,242},
+  {  7,  2,247}, {  8,  1,252}, {  9,  0,  0}, {  9, -1,  4}, {  9, -2,  9}, {  9, -3, 14}, {  9, -4, 19}, {  9, -5, 24},
+  {  9, -6, 29}, {  9, -7, 34}, {  9, -8, 39}, {  9, -9, 43}, {  8, -9, 47}, {  7, -9, 51}, {  6, -9, 56}, {  5, -9, 61},
+  {  4, -9, 67}, {  3, -9, 72}, {  2, -9, 77}, {  1, -9, 81}, {  0, -9, 85}, { -1, -8, 89}, { -2, -7, 94}, { -3, -6, 99},
+  { -4, -5,104}, { -5, -4,109}, { -6, -3,114}, { -7, -2,119}, { -8, -1,124}, { -9,  0,128}, { -9,  1,132}, { -9,  2,137},
+  { -9,  3,142}, { -9,  4,147}, { -9,  5,152}, { -9,  6,157}, { -9,  7,162}, { -9,  8,167},
+  // anneau 10
+  {-10, 10,171}, { -9, 10,174}, { -8, 10,178}, { -7, 10,183}, { -6, 10,187}, { -5, 10,192}, { -4, 10,197}, { -3, 10,201},
+  { -2, 10,206}, { -1, 10,210}, {  0, 10,213}, {  1,  9,217}, {  2,  8,221}, {  3,  7,225}, {  4,  6,230}, {  5,  5,235},
+  {  6,  4,239}, {  7,  3,244}, {  8,  2,248}, {  9,  1,252}, { 10,  0,  0}, { 10, -1,  4}, { 10, -2,  8}, { 10, -3, 12},
+  { 10, -4, 17}, { 10, -5, 21}, { 10, -6, 26}, { 10, -7, 31}, { 10, -8, 35}, { 10, -9, 39}, { 10,-10, 43}, {  9,-10, 46},
+  {  8,-10, 50}, {  7,-10, 55}, {  6,-10, 59}, {  5,-10, 64}, {  4,-10, 69}, {  3,-10, 73}, {  2,-10, 78}, {  1,-10, 82},
+  {  0,-10, 85}, { -1, -9, 89}, { -2, -8, 93}, { -3, -7, 97}, { -4, -6,102}, { -5, -5,107}, { -6, -4,111}, { -7, -3,116},
+  { -8, -2,120}, { -9, -1,124}, {-10,  0,128}, {-10,  1,132}, {-10,  2,136}, {-10,  3,140}, {-10,  4,145}, {-10,  5,149},
+  {-10,  6,154}, {-10,  7,159}, {-10,  8,163}, {-10,  9,167},
+  // anneau 11
+  {-11, 11,171}, {-10, 11,174}, { -9, 11,178}, { -8, 11,182}, { -7, 11,186}, { -6, 11,190}, { -5, 11,194}, { -4, 11,198},
+  { -3, 11,202}, { -2, 11,206}, { -1, 11,210}, {  0, 11,213}, {  1, 10,217}, {  2,  9,220}, {  3,  8,224}, {  4,  7,228},
+  {  5,  6,233}, {  6,  5,237}, {  7,  4,241}, {  8,  3,245}, {  9,  2,249}, { 10,  1,253}, { 11,  0,  0}, { 11, -1,  3},
+  { 11, -2,  7}, { 11, -3, 11}, { 11, -4, 15}, { 11, -5, 19}, { 11, -6, 23}, { 11, -7, 28}, { 11, -8, 32}, { 11, -9, 36},
+  { 11,-10, 39}, { 11,-11, 43}, { 10,-11, 46}, {  9,-11, 50}, {  8,-11, 54}, {  7,-11, 58}, {  6,-11, 62}, {  5,-11, 66},
+  {  4,-11, 70}, {  3,-11, 74}, {  2,-11, 78}, {  1,-11, 82}, {  0,-11, 85}, { -1,-10, 89}, { -2, -9, 92}, { -3, -8, 96},
+  { -4, -7,100}, { -5, -6,105}, { -6, -5,109}, { -7, -4,113}, { -8, -3,117}, { -9, -2,121}, {-10, -1,125}, {-11,  0,128},
+  {-11,  1,131}, {-11,  2,135}, {-11,  3,139}, {-11,  4,143}, {-11,  5,147}, {-11,  6,151}, {-11,  7,156}, {-11,  8,160},
+  {-11,  9,164}, {-11, 10,167},
+  // anneau 12
+  {-12, 12,171}, {-11, 12,174}, {-10, 12,177}, { -9, 12,181}, { -8, 12,184}, { -7, 12,188}, { -6, 12,192}, { -5, 12,196},
+  { -4, 12,200}, { -3, 12,203}, { -2, 12,207}, { -1, 12,210}, {  0, 12,213}, {  1, 11,216}, {  2, 10,220}, {  3,  9,223},
+  {  4,  8,227}, {  5,  7,231}, {  6,  6,235}, {  7,  5,239}, {  8,  4,242}, {  9,  3,246}, { 10,  2,250}, { 11,  1,253},
+  { 12,  0,  0}, { 12, -1,  3}, { 12, -2,  6}, { 12, -3, 10}, { 12, -4, 14}, { 12, -5, 17}, { 12, -6, 21}, { 12, -7, 25},
+  { 12, -8, 29}, { 12, -9, 33}, { 12,-10, 36}, { 12,-11, 40}, { 12,-12, 43}, { 11,-12, 46}, { 10,-12, 49}, {  9,-12, 53},
+  {  8,-12, 56}, {  7,-12, 60}, {  6,-12, 64}, {  5,-12, 68}, {  4,-12, 72}, {  3,-12, 75}, {  2,-12, 79}, {  1,-12, 82},
+  {  0,-12, 85}, { -1,-11, 88}, { -2,-10, 92}, { -3, -9, 95}, { -4, -8, 99}, { -5, -7,103}, { -6, -6,107}, { -7, -5,111},
+  { -8, -4,114}, { -9, -3,118}, {-10, -2,122}, {-11, -1,125}, {-12,  0,128}, {-12,  1,131}, {-12,  2,134}, {-12,  3,138},
+  {-12,  4,142}, {-12,  5,145}, {-12,  6,149}, {-12,  7,153}, {-12,  8,157}, {-12,  9,161}, {-12, 10,164}, {-12, 11,168},
+  // anneau 13
+  {-13, 13,171}, {-12, 13,173}, {-11, 13,177}, {-10, 13,180}, { -9, 13,183}, { -8, 13,187}, { -7, 13,190}, { -6, 13,194},
+  { -5, 13,197}, { -4, 13,201}, { -3, 13,204}, { -2, 13,207}, { -1, 13,211}, {  0, 13,213}, {  1, 12,216}, {  2, 11,219},
+  {  3, 10,222}, {  4,  9,226}, {  5,  8,229}, {  6,  7,233}, {  7,  6,236}, {  8,  5,240}, {  9,  4,244}, { 10,  3,247},
+  { 11,  2,250}, { 12,  1,253}, { 13,  0,  0}, { 13, -1,  3}, { 13, -2,  6}, { 13, -3,  9}, { 13, -4, 12}, { 13, -5, 16},
+  { 13, -6, 20}, { 13, -7, 23}, { 13, -8, 27}, { 13, -9, 30}, { 13,-10, 34}, { 13,-11, 37}, { 13,-12, 40}, { 13,-13, 43},
+  { 12,-13, 45}, { 11,-13, 49}, { 10,-13, 52}, {  9,-13, 55}, {  8,-13, 59}, {  7,-13, 62}, {  6,-13, 66}, {  5,-13, 69},
+  {  4,-13, 73}, {  3,-13, 76}, {  2,-13, 79}, {  1,-13, 83}, {  0,-13, 85}, { -1,-12, 88}, { -2,-11, 91}, { -3,-10, 94},
+  { -4, -9, 98}, { -5, -8,101}, { -6, -7,105}, { -7, -6,108}, { -8, -5,112}, { -9, -4,116}, {-10, -3,119}, {-11, -2,122},
+  {-12, -1,125}, {-13,  0,128}, {-13,  1,131}, {-13,  2,134}, {-13,  3,137}, {-13,  4,140}, {-13,  5,144}, {-13,  6,148},
+  {-13,  7,151}, {-13,  8,155}, {-13,  9,158}, {-13, 10,162}, {-13, 11,165}, {-13, 12,168},
+  // anneau 14
+  {-14, 14,171}, {-13, 14,173}, {-12, 14,176}, {-11, 14,179}, {-10, 14,182}, { -9, 14,185}, { -8, 14,189}, { -7, 14,192},
+  { -6, 14,195}, { -5, 14,199}, { -4, 14,202}, { -3, 14,205}, { -2, 14,208}, { -1, 14,211}, {  0, 14,213}, {  1, 13,216},
+  {  2, 12,219}, {  3, 11,222}, {  4, 10,225}, {  5,  9,228}, {  6,  8,231}, {  7,  7,235}, {  8,  6,238}, {  9,  5,241},
+  { 10,  4,245}, { 11,  3,248}, { 12,  2,251}, { 13,  1,253}, { 14,  0,  0}, { 14, -1,  3}, { 14, -2,  5}, { 14, -3,  8},
+  { 14, -4, 11}, { 14, -5, 15}, { 14, -6, 18}, { 14, -7, 21}, { 14, -8, 25}, { 14, -9, 28}, { 14,-10, 31}, { 14,-11, 34},
+  { 14,-12, 37}, { 14,-13, 40}, { 14,-14, 43}, { 13,-14, 45}, { 12,-14, 48}, { 11,-14, 51}, { 10,-14, 54}, {  9,-14, 57},
+  {  8,-14, 61}, {  7,-14, 64}, {  6,-14, 67}, {  5,-14, 71}, {  4,-14, 74}, {  3,-14, 77}, {  2,-14, 80}, {  1,-14, 83},
+  {  0,-14, 85}, { -1,-13, 88}, { -2,-12, 91}, { -3,-11, 94}, { -4,-10, 97}, { -5, -9,100}, { -6, -8,103}, { -7, -7,107},
+  { -8, -6,110}, { -9, -5,113}, {-10, -4,117}, {-11, -3,120}, {-12, -2,123}, {-13, -1,125}, {-14,  0,128}, {-14,  1,131},
+  {-14,  2,133}, {-14,  3,136}, {-14,  4,139}, {-14,  5,143}, {-14,  6,146}, {-14,  7,149}, {-14,  8,153}, {-14,  9,156},
+  {-14, 10,159}, {-14, 11,162}, {-14, 12,165}, {-14, 13,168},
+};
+
+// ===== Utils =====
+static inline void blendMax(uint8_t* dst, int idx, uint8_t level, uint16_t cov) {
+  if (idx == HEX_INVALID || cov == 0) return;
+  uint8_t v = (uint8_t)(((uint16_t)level * cov) >> 8);   // cov sur 0..256
+  if (v > dst[idx]) dst[idx] = v;
+}
+
+// ===== Formes =====
+// Point sous-LED : répartition barycentrique sur les 3 LEDs du triangle qui le contient
+void hexPlot(uint8_t* dst, HexPos p, uint8_t level) {
+  int q0 = p.q >> 8, r0 = p.r >> 8;
+  uint16_t fq = p.q & 0xFF, fr = p.r & 0xFF;
+  if (fq + fr < 256) {
+    blendMax(dst, hexIndex(q0,     r0    ), level, 256 - fq - fr);
+    blendMax(dst, hexIndex(q0 + 1, r0    ), level, fq);
+    blendMax(dst, hexIndex(q0,     r0 + 1), level, fr);
+  } else {
+    blendMax(dst, hexIndex(q0 + 1, r0 + 1), level, fq + fr - 256);
+    blendMax(dst, hexIndex(q0 + 1, r0    ), level, 256 - fr);
+    blendMax(dst, hexIndex(q0,     r0 + 1), level, 256 - fq);
+  }
+}
+
+// Type Wu : un échantillon par valeur entière de la coordonnée cube qui varie le plus
+// (centres de LED exacts le long des 6 directions), plus les 2 extrémités sous-LED.
+void hexLine(uint8_t* dst, HexPos a, HexPos b, uint8_t level) {
+  hexLine(dst, a, b, level, level);
+}
+
+void hexLine(uint8_t* dst, HexPos a, HexPos b, uint8_t levelA, uint8_t levelB) {
+  int32_t dq = (int32_t)b.q - a.q;
+  int32_t dr = (int32_t)b.r - a.r;
+  int32_t ds = -(dq + dr);
+
+  // axe majeur : ma = coordonnée de a sur cet axe, dm = son déplacement (8.8)
+  int32_t ma = a.q, dm = dq;
+  if (abs(dr) > abs(dm)) { ma = a.r;          dm = dr; }
+  if (abs(ds) > abs(dm)) { ma = -(a.q + a.r); dm = ds; }
+
+  hexPlot(dst, a, levelA);
+  hexPlot(dst, b, levelB);
+  if (dm == 0) return;
+
+  int32_t lo = min(ma, ma + dm), hi = max(ma, ma + dm);
+  int16_t dl = (int16_t)levelB - levelA;
+  for (int32_t m = (lo + 255) & ~(int32_t)255; m <= hi; m += 256) {
+    int32_t u = m - ma;                                  // u / dm = avancement 0..1
+    HexPos p = { (int16_t)(a.q + dq * u / dm), (int16_t)(a.r + dr * u / dm) };
+    hexPlot(dst, p, (uint8_t)(levelA + dl * u / dm));
+  }
+}
+
+// Au-delà de HEX_RING_MAX + 1 rien n'est plus dessiné ; borner évite que k (uint8_t) reparte
+// à 0 pour radius >= 0xFF00
+static constexpr uint16_t RADIUS_MAX = (uint16_t)(HEX_RING_MAX + 1) << 8;
+
+// Anneau de rayon fractionnaire : k = partie entière, la fraction glisse vers l'anneau k+1
+void hexRing(uint8_t* dst, int cq, int cr, uint16_t radius, uint8_t level) {
+  if (radius > RADIUS_MAX) radius = RADIUS_MAX;
+  uint8_t  k = radius >> 8;
+  uint16_t f = radius & 0xFF;
+  hexForRing(cq, cr, k,     [&](int idx, uint8_t) { blendMax(dst, idx, level, 256 - f); });
+  hexForRing(cq, cr, k + 1, [&](int idx, uint8_t) { blendMax(dst, idx, level, f); });
+}
+
+void hexFill(uint8_t* dst, int cq, int cr, uint16_t radius, uint8_t level) {
+  hexSector(dst, cq, cr, radius, 0, 0, level);
+}
+
+// Couverture angulaire 0..256 d'une LED d'angle ang pour un secteur de centre c et demi-ouverture
+// half : linéaire sur la demi-largeur angulaire h de la LED (anneau j : 6j LEDs -> h ~ 21 / j)
+static uint16_t angularCov(uint8_t ang, uint8_t c, uint8_t half, uint8_t j) {
+  int16_t h = (128 + 3 * j) / (6 * j);
+  if (h < 1) h = 1;
+  int16_t d = (int16_t)half - abs((int8_t)(uint8_t)(ang - c));   // > 0 à l'intérieur
+  if (d >= h)  return 256;
+  if (d <= -h) return 0;
+  return (uint16_t)(((d + h) * 128) / h);
+}
+
+// Secteur [a0, a1) ; a0 == a1 -> disque complet
+void hexSector(uint8_t* dst, int cq, int cr, uint16_t radius, uint8_t a0, uint8_t a1, uint8_t level) {
+  if (radius > RADIUS_MAX) radius = RADIUS_MAX;
+  uint8_t  k = radius >> 8;
+  uint16_t f = radius & 0xFF;
+  uint8_t  span = a1 - a0;
+  uint8_t  half = span >> 1;
+  uint8_t  c = a0 + half;
+  auto cov = [&](uint8_t j, uint8_t ang) -> uint16_t {
+    return (span == 0 || j == 0) ? 256 : angularCov(ang, c, half, j);
+  };
+  for (uint8_t j = 0; j <= k && j <= HEX_RING_MAX; ++j) {
+    hexForRing(cq, cr, j, [&](int idx, uint8_t ang) { blendMax(dst, idx, level, cov(j, ang)); });
+  }
+  const uint8_t j = k + 1;
+  hexForRing(cq, cr, j, [&](int idx, uint8_t ang) { blendMax(dst, idx, level, (f * cov(j, ang)) >> 8); });
+}
+
+void hexSprite(uint8_t* dst, const int8_t (*pts)[2], uint8_t count, HexPos origin, uint16_t scale, uint8_t level) {
+  for (uint8_t i = 0; i < count; ++i) {
+    int16_t dq = (int8_t)pgm_read_byte(&pts[i][0]);
+    int16_t dr = (int8_t)pgm_read_byte(&pts[i][1]);
+    HexPos p = { (int16_t)(origin.q + (int16_t)((int32_t)dq * scale)),
+                 (int16_t)(origin.r + (int16_t)((int32_t)dr * scale)) };
+    hexPlot(dst, p, level);
+  }
+}
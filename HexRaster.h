@@ -0,0 +1,42 @@
+#pragma once
+#include <Arduino.h>
+#include "HexGrid.h"
+
+// Rastérisation anti-aliasée sur le grand hex.
+// Les formes s'accumulent dans un tampon dst[NUM_LEDS] par max(dst, niveau * couverture),
+// comme les cibles "target" des scénarios. Seules les LEDs touchées sont visitées.
+//
+// Positions sous-LED en axial 8.8 (256 = 1 LED) ; rayons en 8.8 ; angles 0..255 = tour complet,
+// 0 = est, sens trigonométrique.
+
+struct HexPos { int16_t q, r; };
+
+static constexpr uint8_t HEX_RING_MAX = 2 * HEX_R;   // couvre tout le hex depuis n'importe quel centre
+
+// Spirale en flash : anneau k = entrées [HEX_RING_START[k], HEX_RING_START[k+1])
+struct HexRingCell { int8_t dq, dr; uint8_t angle; };
+extern const HexRingCell HEX_SPIRAL[];
+extern const uint16_t HEX_RING_START[HEX_RING_MAX + 2];
+
+// Appelle f(idx, angle) pour chaque LED de l'anneau k centré en (cq, cr)
+template <typename F>
+void hexForRing(int cq, int cr, uint8_t k, F f) {
+  if (k > HEX_RING_MAX) return;
+  uint16_t e = pgm_read_word(&HEX_RING_START[k + 1]);
+  for (uint16_t j = pgm_read_word(&HEX_RING_START[k]); j < e; ++j) {
+    int idx = hexIndex(cq + (int8_t)pgm_read_byte(&HEX_SPIRAL[j].dq),
+                       cr + (int8_t)pgm_read_byte(&HEX_SPIRAL[j].dr));
+    if (idx != HEX_INVALID) f(idx, pgm_read_byte(&HEX_SPIRAL[j].angle));
+  }
+}
+
+void hexPlot(uint8_t* dst, HexPos p, uint8_t level);                     // point sous-LED
+void hexLine(uint8_t* dst, HexPos a, HexPos b, uint8_t level);
+void hexLine(uint8_t* dst, HexPos a, HexPos b, uint8_t levelA, uint8_t levelB);   // dégradé a -> b
+void hexRing(uint8_t* dst, int cq, int cr, uint16_t radius, uint8_t level);
+void hexFill(uint8_t* dst, int cq, int cr, uint16_t radius, uint8_t level);
+// Secteur [a0, a1) : bords anti-aliasés (rayon fractionnaire et bords angulaires)
+void hexSector(uint8_t* dst, int cq, int cr, uint16_t radius, uint8_t a0, uint8_t a1, uint8_t level);
+
+// Sprite : count points (dq, dr) en flash, placés en origin + pt * scale (scale 8.8, 256 = 1:1)
+void hexSprite(uint8_t* dst, const int8_t (*pts)[2], uint8_t count, HexPos origin, uint16_t scale, uint8_t level);
@@ -12,6 +12,9 @@ void ledsBegin() {
 }
 
 void ledsShow() {
+  #if USE_BENCH
+    return;  // banc : seul le coût de calcul du tick est mesuré
+  #endif
   #if USE_VIDEO_DITHER
     FastLED.setDither(BINARY_DITHER);
   #endif
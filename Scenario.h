@@ -6,4 +6,5 @@ public:
   virtual ~Scenario() {}
   virtual void begin() = 0;                 // called once in setup()
   virtual void tick(uint32_t now) = 0;      // called every loop()
+  virtual void end() {}                     // called when switching to another scenario
 };
@@ -0,0 +1,258 @@
+#include <FastLED.h>
+#include "Config.h"
+#include "Leds.h"
+#include "ScenarioAudio.h"
+#include "HexGrid.h"
+
+// ===== Tuning =====
+static constexpr uint8_t  BASE_LEVEL        = 8;     // lueur de fond
+static constexpr uint16_t NOISE_FLOOR       = 24;    // énergie en dessous de laquelle une bande reste éteinte
+static constexpr uint16_t PEAK_FLOOR        = 160;   // AGC : référence min (un souffle ne sature pas)
+static constexpr uint8_t  PEAK_DECAY_SHIFT  = 7;     // AGC : la référence perd ~1/128 par trame
+
+// Anti-scintillement (EMA asymétrique, par anneau)
+static constexpr uint8_t  ATTACK_ALPHA_256  = 200;
+static constexpr uint8_t  DECAY_ALPHA_256   = 40;
+
+// ===== FFT =====
+static constexpr uint8_t  FFT_N    = AUDIO_FFT_N;
+static constexpr uint8_t  NUM_BANDS = 8;
+
+// sin(2*pi*k/64) en Q15, k = 0..47 (cos(k) = sin(k + 16))
+static const int16_t SINE_Q15[FFT_N * 3 / 4] PROGMEM = {
+  0, 3212, 6393, 9512, 12539, 15446, 18204, 20787, 23170, 25329, 27245, 28898, 30273, 31356, 32137, 32609,
+  32767, 32609, 32137, 31356, 30273, 28898, 27245, 25329, 23170, 20787, 18204, 15446, 12539, 9512, 6393, 3212,
+  0, -3212, -6393, -9512, -12539, -15446, -18204, -20787, -23170, -25329, -27245, -28898, -30273, -31356, -32137, -32609
+};
+
+// Fenêtre de Hann (demi, symétrique), 0..255
+static const uint8_t HANN[FFT_N / 2] PROGMEM = {
+  0, 1, 3, 6, 10, 16, 22, 30, 38, 48, 58, 69, 81, 93, 105, 118,
+  131, 143, 156, 168, 180, 191, 202, 212, 221, 229, 236, 242, 247, 251, 254, 255
+};
+
+// Bornes des bandes en bins (100 Hz/bin à 6400 Hz), espacement ~logarithmique
+static const uint8_t BAND_EDGES[NUM_BANDS + 1] = { 1, 2, 3, 4, 6, 9, 13, 19, 32 };
+
+static_assert(NUM_BANDS == HEX_R + 1, "une bande par anneau");
+
+// ===== State =====
+static uint8_t  ringOf[NUM_LEDS];      // anneau (distance hex au centre) de chaque LED
+static int16_t  re[FFT_N], im[FFT_N];
+static uint8_t  samples[FFT_N];
+static uint16_t bandEnergy[NUM_BANDS];
+static uint16_t agcPeak;               // référence AGC commune à toutes les bandes
+static uint8_t  ringVals[NUM_BANDS];   // sortie lissée par anneau
+
+// ===== Acquisition =====
+// ATmega328P/168 : conversions déclenchées par Timer1 (COMPB) à MIC_SAMPLE_HZ, ISR -> anneau.
+// FastLED.show() coupe les IRQ ~5 ms : l'anneau contient alors un trou de ~30 échantillons.
+// samplerRestart() (juste après show) remet fresh à 0 et samplerRead() attend FFT_N
+// échantillons neufs : le bloc analysé est toujours contigu.
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega168__)
+static volatile uint8_t ring[FFT_N];
+static volatile uint8_t ringHead = 0;
+static volatile uint8_t fresh = 0;      // échantillons reçus depuis samplerRestart(), sature à FFT_N
+
+ISR(ADC_vect) {
+  ring[ringHead] = ADCH;                  // ADLAR : 8 bits de poids fort
+  ringHead = (ringHead + 1) & (FFT_N - 1);
+  if (fresh < FFT_N) fresh++;
+  TIFR1 = _BV(OCF1B);                     // réarme le déclenchement
+}
+
+static void samplerStart() {
+  noInterrupts();
+  TCCR1A = 0;
+  TCCR1B = _BV(WGM12) | _BV(CS11);        // CTC, horloge / 8
+  OCR1A  = (F_CPU / 8 / MIC_SAMPLE_HZ) - 1;
+  OCR1B  = OCR1A;
+  TCNT1  = 0;
+  fresh  = 0;
+  ADMUX  = _BV(REFS0) | _BV(ADLAR) | ((PIN_MIC - A0) & 0x07);
+  ADCSRB = _BV(ADTS2) | _BV(ADTS0);       // source : Timer1 compare B
+  ADCSRA = _BV(ADEN) | _BV(ADATE) | _BV(ADIE) | _BV(ADPS2) | _BV(ADPS1); // ADC / 64
+  interrupts();
+}
+
+static void samplerStop() {
+  noInterrupts();
+  ADCSRA = _BV(ADEN) | _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0); // réglage attendu par analogRead()
+  ADCSRB = 0;
+  TCCR1B = 0;
+  interrupts();
+}
+
+static void samplerRestart() {
+  fresh = 0;
+}
+
+// attend un bloc complet sans trou, puis copie les FFT_N derniers échantillons,
+// du plus ancien au plus récent
+static void samplerRead() {
+  while (fresh < FFT_N) {}
+  noInterrupts();
+  uint8_t h = ringHead;
+  for (uint8_t k = 0; k < FFT_N; ++k) samples[k] = ring[(h + k) & (FFT_N - 1)];
+  interrupts();
+}
+#else
+static void samplerStart() {}
+static void samplerStop() {}
+static void samplerRestart() {}
+
+// Sans déclenchement matériel : bloc capturé à cadence fixe (10 ms à 6400 Hz)
+static void samplerRead() {
+  const uint32_t period = 1000000UL / MIC_SAMPLE_HZ;
+  uint32_t t0 = micros();
+  for (uint8_t k = 0; k < FFT_N; ++k) {
+    while ((micros() - t0) < (uint32_t)k * period) {}
+    samples[k] = (uint8_t)(analogRead(PIN_MIC) >> (MIC_ADC_BITS - 8));
+  }
+}
+#endif
+
+// ===== Analyse =====
+static void loadWindowed() {
+  uint16_t sum = 0;
+  for (uint8_t k = 0; k < FFT_N; ++k) sum += samples[k];
+  uint8_t dc = sum / FFT_N;
+
+  for (uint8_t k = 0; k < FFT_N; ++k) {
+    uint8_t w = pgm_read_byte(&HANN[k < FFT_N / 2 ? k : FFT_N - 1 - k]);
+    int16_t x = ((int16_t)samples[k] - dc) << 6;   // ±16320 (écart à la moyenne ≤ 255)
+    re[k] = (int16_t)(((int32_t)x * w) >> 8);
+    im[k] = 0;
+  }
+}
+
+// Radix-2 DIT en place, Q15, /2 à chaque étage (sortie = DFT / FFT_N, sans débordement)
+static void fft() {
+  for (uint8_t i = 1, j = 0; i < FFT_N; ++i) {
+    uint8_t bit = FFT_N >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) {
+      int16_t t = re[i]; re[i] = re[j]; re[j] = t;
+      t = im[i]; im[i] = im[j]; im[j] = t;
+    }
+  }
+
+  for (uint8_t len = 2; len <= FFT_N; len <<= 1) {
+    uint8_t half = len >> 1;
+    uint8_t step = FFT_N / len;
+    for (uint8_t k = 0; k < half; ++k) {
+      int16_t c = (int16_t)pgm_read_word(&SINE_Q15[k * step + FFT_N / 4]);
+      int16_t s = -(int16_t)pgm_read_word(&SINE_Q15[k * step]);
+      for (uint8_t a = k; a < FFT_N; a += len) {
+        uint8_t b = a + half;
+        int16_t tr = (int16_t)(((int32_t)re[b] * c - (int32_t)im[b] * s) >> 15);
+        int16_t ti = (int16_t)(((int32_t)re[b] * s + (int32_t)im[b] * c) >> 15);
+        re[b] = (re[a] - tr) >> 1;  im[b] = (im[a] - ti) >> 1;
+        re[a] = (re[a] + tr) >> 1;  im[a] = (im[a] + ti) >> 1;
+      }
+    }
+  }
+}
+
+// |z| ~ max + 3/8 min (erreur < 7 %)
+static uint16_t magnitude(int16_t x, int16_t y) {
+  uint16_t ax = x < 0 ? -x : x;
+  uint16_t ay = y < 0 ? -y : y;
+  return ax > ay ? ax + ((ay * 3) >> 3) : ay + ((ax * 3) >> 3);
+}
+
+static void updateBands() {
+  uint16_t top = 0;
+  for (uint8_t b = 0; b < NUM_BANDS; ++b) {
+    uint16_t e = 0;
+    for (uint8_t k = BAND_EDGES[b]; k < BAND_EDGES[b + 1]; ++k) {
+      uint16_t m = magnitude(re[k], im[k]);
+      e = (e > 0xFFFF - m) ? 0xFFFF : e + m;
+    }
+    bandEnergy[b] = e;
+    if (e > top) top = e;
+  }
+
+  // AGC : une seule référence (bande la plus forte) pour garder les rapports entre bandes ;
+  // décroissance lente (+1 pour descendre aussi sous 128), plancher au-dessus du bruit
+  uint16_t p = agcPeak;
+  p = (top > p) ? top : p - ((p >> PEAK_DECAY_SHIFT) + 1);
+  if (p < PEAK_FLOOR) p = PEAK_FLOOR;
+  agcPeak = p;
+
+  for (uint8_t b = 0; b < NUM_BANDS; ++b) {
+    uint16_t e = bandEnergy[b];
+    uint8_t level = (e <= NOISE_FLOOR) ? 0 : (uint8_t)(((uint32_t)(e - NOISE_FLOOR) * 255) / (p - NOISE_FLOOR + 1));
+
+    uint16_t s = ringVals[b];
+    uint16_t a = (level > s) ? ATTACK_ALPHA_256 : DECAY_ALPHA_256;
+    ringVals[b] = (uint8_t)(((s * (256 - a)) + (level * a)) >> 8);
+  }
+}
+
+static void buildRings() {
+  const Axial center = { 0, 0 };
+  for (int i = 0; i < NUM_LEDS; ++i) ringOf[i] = hexDistance(hexCoord(i), center);
+}
+
+static void resetBands() {
+  agcPeak = PEAK_FLOOR;
+  for (uint8_t b = 0; b < NUM_BANDS; ++b) ringVals[b] = 0;
+}
+
+static void renderRings() {
+  for (int i = 0; i < NUM_LEDS; ++i) {
+    uint8_t v = ringVals[ringOf[i]];
+    if (v < BASE_LEVEL) v = BASE_LEVEL;
+    leds[i] = CRGB(v, v, v);
+  }
+  ledsShow();
+}
+
+// ===== Public API =====
+void ScenarioAudio::begin() {
+  randomSeed(analogRead(A0));
+  buildRings();
+  resetBands();
+  samplerStart();
+}
+
+void ScenarioAudio::end() {
+  samplerStop();
+}
+
+void ScenarioAudio::tick(uint32_t now) {
+  (void)now;
+  samplerRead();
+  loadWindowed();
+  fft();
+  updateBands();
+  renderRings();
+  samplerRestart();
+}
+
+#if USE_BENCH
+// sin(2*pi*i/64) en Q15 sur une période complète
+static int16_t sineAt(uint8_t i) {
+  i &= FFT_N - 1;
+  return (i < FFT_N * 3 / 4) ? (int16_t)pgm_read_word(&SINE_Q15[i])
+                             : -(int16_t)pgm_read_word(&SINE_Q15[i - FFT_N / 2]);
+}
+
+void audioBenchBegin() {
+  buildRings();
+  resetBands();
+  // 300 Hz + 1100 Hz (bins 3 et 11), même dynamique qu'un micro réel
+  for (uint8_t k = 0; k < FFT_N; ++k) {
+    samples[k] = (uint8_t)(128 + (sineAt(3 * k) >> 9) + (sineAt(11 * k) >> 10));
+  }
+}
+
+void audioBenchTick() {
+  loadWindowed();
+  fft();
+  updateBands();
+  renderRings();
+}
+#endif
@@ -0,0 +1,21 @@
+#pragma once
+#include "Scenario.h"
+#include "Config.h"
+
+static constexpr uint8_t AUDIO_FFT_N = 64;   // échantillons par bloc analysé
+
+// Audio-réactif : micro sur PIN_MIC, FFT 64 points en virgule fixe,
+// 8 bandes de fréquence -> 8 anneaux hex (graves au centre, aigus au bord)
+class ScenarioAudio : public Scenario {
+public:
+  void begin() override;
+  void tick(uint32_t now) override;
+  void end() override;
+};
+
+#if USE_BENCH
+// Banc : analyse seule (fenêtre + FFT + bandes + anneaux) sur un bloc synthétique fixe,
+// sans Timer1 ni ADC. Budget : un bloc toutes les AUDIO_FFT_N / MIC_SAMPLE_HZ s.
+void audioBenchBegin();
+void audioBenchTick();
+#endif
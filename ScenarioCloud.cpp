@@ -2,6 +2,7 @@
 #include "Leds.h"
 #include "ScenarioCloud.h"
 #include "Background.h"
+#include "EffectPool.h"
 
 // === Tuning ===
 static constexpr uint8_t  ACTIVE_COUNT      = 40;     // nb de LEDs en pulsation simultanées
@@ -15,14 +16,11 @@ static constexpr uint8_t  ATTACK_ALPHA_256  = 220;    // montée rapide
 static constexpr uint8_t  DECAY_ALPHA_256   = 80;     // descente plus douce
 
 struct Pulse {
-  int      idx = -1;
-  uint32_t start = 0;
+  uint16_t idx = 0;
   uint16_t duration = 0;
-  bool     inUse = false;
-  uint32_t lastUseEnd = 0;
 };
 
-static Pulse pulses[ACTIVE_COUNT];
+static EffectPool<Pulse, ACTIVE_COUNT> pulses;
 static bool  ledIsActive[NUM_LEDS];
 static uint32_t ledLastEnded[NUM_LEDS];
 
@@ -35,21 +33,15 @@ static float easeInOutUpDown(float t) { // 0..1..0
   return sinf(3.14159265f * t);
 }
 
-static bool isIndexAlreadyActive(int idx) {
-  for (int i = 0; i < ACTIVE_COUNT; ++i)
-    if (pulses[i].inUse && pulses[i].idx == idx) return true;
-  return false;
-}
-
 static int pickRandomAvailableIndex(uint32_t now) {
   for (int attempt = 0; attempt < 40; ++attempt) {
     int idx = random(NUM_LEDS);
-    if (isIndexAlreadyActive(idx)) continue;
+    if (ledIsActive[idx]) continue;
     if (now - ledLastEnded[idx] < COOLDOWN_MS) continue;
     return idx;
   }
   for (int idx = 0; idx < NUM_LEDS; ++idx)
-    if (!isIndexAlreadyActive(idx)) return idx;
+    if (!ledIsActive[idx]) return idx;
   return -1;
 }
 
@@ -57,29 +49,28 @@ static uint16_t randDuration() {
   return PULSE_MIN_MS + random(PULSE_MAX_MS - PULSE_MIN_MS + 1);
 }
 
-static void startPulse(Pulse &p, uint32_t now) {
+static bool startPulse(uint32_t now) {
   int idx = pickRandomAvailableIndex(now);
-  if (idx < 0) { p.inUse = false; return; }
-  p.idx      = idx;
-  p.start    = now;
-  p.duration = randDuration();
-  p.inUse    = true;
+  if (idx < 0) return false;
+  int16_t s = pulses.acquire(now);
+  if (s < 0) return false;
+  pulses[s].idx      = idx;
+  pulses[s].duration = randDuration();
   ledIsActive[idx] = true;
+  return true;
 }
 
-static void endPulse(Pulse &p, uint32_t now) {
-  p.inUse = false;
-  ledIsActive[p.idx] = false;
-  p.lastUseEnd = now;
-  ledLastEnded[p.idx] = now;
+static void endPulse(uint8_t s, uint32_t now) {
+  uint16_t idx = pulses[s].idx;
+  ledIsActive[idx] = false;
+  ledLastEnded[idx] = now;
+  pulses.release(s);
 }
 
 void ScenarioCloud::begin() {
   randomSeed(analogRead(A0));
 
-  for (int i = 0; i < ACTIVE_COUNT; ++i) {
-    pulses[i] = Pulse{};
-  }
+  pulses.clear();
   for (int i = 0; i < NUM_LEDS; ++i) {
     ledIsActive[i] = false;
     ledLastEnded[i] = 0;
@@ -97,29 +88,26 @@ void ScenarioCloud::tick(uint32_t now) {
   }
 
   // --- Maintenir ACTIVE_COUNT pulsations actives ---
-  int active = 0;
-  for (int i = 0; i < ACTIVE_COUNT; ++i) if (pulses[i].inUse) active++;
-  for (int i = 0; i < ACTIVE_COUNT; ++i) {
-    if (active >= ACTIVE_COUNT) break;
-    if (!pulses[i].inUse) { startPulse(pulses[i], now); active++; }
+  while (!pulses.full()) {
+    if (!startPulse(now)) break;
   }
 
   // --- Construire la cible (target) : max(fond, pulsations) ---
   static uint8_t target[NUM_LEDS];
   for (int i = 0; i < NUM_LEDS; ++i) target[i] = baseVals[i];
 
-  for (int i = 0; i < ACTIVE_COUNT; ++i) {
-    if (!pulses[i].inUse) continue;
-    uint32_t elapsed = now - pulses[i].start;
-    if (elapsed >= pulses[i].duration) {
-      endPulse(pulses[i], now);
-      startPulse(pulses[i], now); // relance immédiate pour garder le compte constant
+  for (uint8_t k = pulses.size(); k-- > 0;) {   // à rebours : release() ne déplace que des slots déjà vus
+    uint8_t  p = pulses.slotAt(k);
+    uint32_t elapsed = now - pulses.start(p);
+    if (elapsed >= pulses[p].duration) {
+      endPulse(p, now);
+      startPulse(now); // relance immédiate pour garder le compte constant
       continue;
     }
-    float t = (float)elapsed / (float)pulses[i].duration; // 0..1
+    float t = (float)elapsed / (float)pulses[p].duration; // 0..1
     float e = easeInOutUpDown(t);                         // 0..1..0
     int val = (int)(e * PEAK_BRIGHTNESS);
-    int idx = pulses[i].idx;
+    int idx = pulses[p].idx;
 
     // superposer la pulsation par-dessus le fond
     if (val > target[idx]) target[idx] = clamp8i(val);
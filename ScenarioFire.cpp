@@ -0,0 +1,253 @@
+#include <FastLED.h>
+#include "Config.h"
+#include "Leds.h"
+#include "ScenarioFire.h"
+
+// ===== Tuning =====
+static constexpr uint16_t STEP_MS          = 33;    // pas de simulation (~30/s)
+static constexpr uint8_t  COOLING_MAX      = 18;    // refroidissement aléatoire max par pas
+static constexpr uint8_t  SPARKS_PER_STEP  = 3;     // braises injectées par pas
+static constexpr uint8_t  SPARK_MIN        = 160;
+static constexpr uint8_t  SPARK_MAX        = 255;
+
+// ===== Grid =====
+// Table de voisinage du grand hex (R=7), même câblage serpentin que HexGrid :
+// lignes r = -7..7 de haut en bas, lignes impaires inversées.
+// Directions (axial) : E, NE, NW, W, SW, SE. Hors grille -> GHOST (cellule toujours froide),
+// sauf SW/SE qui pointent sur la cellule elle-même (foyer : le bas se nourrit de lui-même).
+// Les bords sont ainsi gérés par la table, sans branchement dans le noyau.
+static_assert(NUM_LEDS == 169, "ScenarioFire: table de voisinage calculée pour le hex R=7");
+static constexpr uint8_t GHOST = NUM_LEDS;
+enum : uint8_t { D_E, D_NE, D_NW, D_W, D_SW, D_SE };
+
+// Braises : deux rangées du bas (r = 6 et r = 7)
+static constexpr uint8_t SPARK_FIRST = NUM_LEDS - 17;
+
+static const uint8_t NEIGH[NUM_LEDS][6] PROGMEM = {
+  {  1, 169, 169, 169,  16,  15},  //   0 ( 0,-7)
+  {  2, 169, 169,   0,  15,  14},  //   1 ( 1,-7)
+  {  3, 169, 169,   1,  14,  13},  //   2 ( 2,-7)
+  {  4, 169, 169,   2,  13,  12},  //   3 ( 3,-7)
+  {  5, 169, 169,   3,  12,  11},  //   4 ( 4,-7)
+  {  6, 169, 169,   4,  11,  10},  //   5 ( 5,-7)
+  {  7, 169, 169,   5,  10,   9},  //   6 ( 6,-7)
+  {169, 169, 169,   6,   9,   8},  //   7 ( 7,-7)
+  {169, 169,   7,   9,  25,  26},  //   8 ( 7,-6)
+  {  8,   7,   6,  10,  24,  25},  //   9 ( 6,-6)
+  {  9,   6,   5,  11,  23,  24},  //  10 ( 5,-6)
+  { 10,   5,   4,  12,  22,  23},  //  11 ( 4,-6)
+  { 11,   4,   3,  13,  21,  22},  //  12 ( 3,-6)
+  { 12,   3,   2,  14,  20,  21},  //  13 ( 2,-6)
+  { 13,   2,   1,  15,  19,  20},  //  14 ( 1,-6)
+  { 14,   1,   0,  16,  18,  19},  //  15 ( 0,-6)
+  { 15,   0, 169, 169,  17,  18},  //  16 (-1,-6)
+  { 18,  16, 169, 169,  37,  36},  //  17 (-2,-5)
+  { 19,  15,  16,  17,  36,  35},  //  18 (-1,-5)
+  { 20,  14,  15,  18,  35,  34},  //  19 ( 0,-5)
+  { 21,  13,  14,  19,  34,  33},  //  20 ( 1,-5)
+  { 22,  12,  13,  20,  33,  32},  //  21 ( 2,-5)
+  { 23,  11,  12,  21,  32,  31},  //  22 ( 3,-5)
+  { 24,  10,  11,  22,  31,  30},  //  23 ( 4,-5)
+  { 25,   9,  10,  23,  30,  29},  //  24 ( 5,-5)
+  { 26,   8,   9,  24,  29,  28},  //  25 ( 6,-5)
+  {169, 169,   8,  25,  28,  27},  //  26 ( 7,-5)
+  {169, 169,  26,  28,  48,  49},  //  27 ( 7,-4)
+  { 27,  26,  25,  29,  47,  48},  //  28 ( 6,-4)
+  { 28,  25,  24,  30,  46,  47},  //  29 ( 5,-4)
+  { 29,  24,  23,  31,  45,  46},  //  30 ( 4,-4)
+  { 30,  23,  22,  32,  44,  45},  //  31 ( 3,-4)
+  { 31,  22,  21,  33,  43,  44},  //  32 ( 2,-4)
+  { 32,  21,  20,  34,  42,  43},  //  33 ( 1,-4)
+  { 33,  20,  19,  35,  41,  42},  //  34 ( 0,-4)
+  { 34,  19,  18,  36,  40,  41},  //  35 (-1,-4)
+  { 35,  18,  17,  37,  39,  40},  //  36 (-2,-4)
+  { 36,  17, 169, 169,  38,  39},  //  37 (-3,-4)
+  { 39,  37, 169, 169,  62,  61},  //  38 (-4,-3)
+  { 40,  36,  37,  38,  61,  60},  //  39 (-3,-3)
+  { 41,  35,  36,  39,  60,  59},  //  40 (-2,-3)
+  { 42,  34,  35,  40,  59,  58},  //  41 (-1,-3)
+  { 43,  33,  34,  41,  58,  57},  //  42 ( 0,-3)
+  { 44,  32,  33,  42,  57,  56},  //  43 ( 1,-3)
+  { 45,  31,  32,  43,  56,  55},  //  44 ( 2,-3)
+  { 46,  30,  31,  44,  55,  54},  //  45 ( 3,-3)
+  { 47,  29,  30,  45,  54,  53},  //  46 ( 4,-3)
+  { 48,  28,  29,  46,  53,  52},  //  47 ( 5,-3)
+  { 49,  27,  28,  47,  52,  51},  //  48 ( 6,-3)
+  {169, 169,  27,  48,  51,  50},  //  49 ( 7,-3)
+  {169, 169,  49,  51,  75,  76},  //  50 ( 7,-2)
+  { 50,  49,  48,  52,  74,  75},  //  51 ( 6,-2)
+  { 51,  48,  47,  53,  73,  74},  //  52 ( 5,-2)
+  { 52,  47,  46,  54,  72,  73},  //  53 ( 4,-2)
+  { 53,  46,  45,  55,  71,  72},  //  54 ( 3,-2)
+  { 54,  45,  44,  56,  70,  71},  //  55 ( 2,-2)
+  { 55,  44,  43,  57,  69,  70},  //  56 ( 1,-2)
+  { 56,  43,  42,  58,  68,  69},  //  57 ( 0,-2)
+  { 57,  42,  41,  59,  67,  68},  //  58 (-1,-2)
+  { 58,  41,  40,  60,  66,  67},  //  59 (-2,-2)
+  { 59,  40,  39,  61,  65,  66},  //  60 (-3,-2)
+  { 60,  39,  38,  62,  64,  65},  //  61 (-4,-2)
+  { 61,  38, 169, 169,  63,  64},  //  62 (-5,-2)
+  { 64,  62, 169, 169,  91,  90},  //  63 (-6,-1)
+  { 65,  61,  62,  63,  90,  89},  //  64 (-5,-1)
+  { 66,  60,  61,  64,  89,  88},  //  65 (-4,-1)
+  { 67,  59,  60,  65,  88,  87},  //  66 (-3,-1)
+  { 68,  58,  59,  66,  87,  86},  //  67 (-2,-1)
+  { 69,  57,  58,  67,  86,  85},  //  68 (-1,-1)
+  { 70,  56,  57,  68,  85,  84},  //  69 ( 0,-1)
+  { 71,  55,  56,  69,  84,  83},  //  70 ( 1,-1)
+  { 72,  54,  55,  70,  83,  82},  //  71 ( 2,-1)
+  { 73,  53,  54,  71,  82,  81},  //  72 ( 3,-1)
+  { 74,  52,  53,  72,  81,  80},  //  73 ( 4,-1)
+  { 75,  51,  52,  73,  80,  79},  //  74 ( 5,-1)
+  { 76,  50,  51,  74,  79,  78},  //  75 ( 6,-1)
+  {169, 169,  50,  75,  78,  77},  //  76 ( 7,-1)
+  {169, 169,  76,  78, 105,  77},  //  77 ( 7, 0)
+  { 77,  76,  75,  79, 104, 105},  //  78 ( 6, 0)
+  { 78,  75,  74,  80, 103, 104},  //  79 ( 5, 0)
+  { 79,  74,  73,  81, 102, 103},  //  80 ( 4, 0)
+  { 80,  73,  72,  82, 101, 102},  //  81 ( 3, 0)
+  { 81,  72,  71,  83, 100, 101},  //  82 ( 2, 0)
+  { 82,  71,  70,  84,  99, 100},  //  83 ( 1, 0)
+  { 83,  70,  69,  85,  98,  99},  //  84 ( 0, 0)
+  { 84,  69,  68,  86,  97,  98},  //  85 (-1, 0)
+  { 85,  68,  67,  87,  96,  97},  //  86 (-2, 0)
+  { 86,  67,  66,  88,  95,  96},  //  87 (-3, 0)
+  { 87,  66,  65,  89,  94,  95},  //  88 (-4, 0)
+  { 88,  65,  64,  90,  93,  94},  //  89 (-5, 0)
+  { 89,  64,  63,  91,  92,  93},  //  90 (-6, 0)
+  { 90,  63, 169, 169,  91,  92},  //  91 (-7, 0)
+  { 93,  90,  91, 169,  92, 118},  //  92 (-7, 1)
+  { 94,  89,  90,  92, 118, 117},  //  93 (-6, 1)
+  { 95,  88,  89,  93, 117, 116},  //  94 (-5, 1)
+  { 96,  87,  88,  94, 116, 115},  //  95 (-4, 1)
+  { 97,  86,  87,  95, 115, 114},  //  96 (-3, 1)
+  { 98,  85,  86,  96, 114, 113},  //  97 (-2, 1)
+  { 99,  84,  85,  97, 113, 112},  //  98 (-1, 1)
+  {100,  83,  84,  98, 112, 111},  //  99 ( 0, 1)
+  {101,  82,  83,  99, 111, 110},  // 100 ( 1, 1)
+  {102,  81,  82, 100, 110, 109},  // 101 ( 2, 1)
+  {103,  80,  81, 101, 109, 108},  // 102 ( 3, 1)
+  {104,  79,  80, 102, 108, 107},  // 103 ( 4, 1)
+  {105,  78,  79, 103, 107, 106},  // 104 ( 5, 1)
+  {169,  77,  78, 104, 106, 105},  // 105 ( 6, 1)
+  {169, 105, 104, 107, 130, 106},  // 106 ( 5, 2)
+  {106, 104, 103, 108, 129, 130},  // 107 ( 4, 2)
+  {107, 103, 102, 109, 128, 129},  // 108 ( 3, 2)
+  {108, 102, 101, 110, 127, 128},  // 109 ( 2, 2)
+  {109, 101, 100, 111, 126, 127},  // 110 ( 1, 2)
+  {110, 100,  99, 112, 125, 126},  // 111 ( 0, 2)
+  {111,  99,  98, 113, 124, 125},  // 112 (-1, 2)
+  {112,  98,  97, 114, 123, 124},  // 113 (-2, 2)
+  {113,  97,  96, 115, 122, 123},  // 114 (-3, 2)
+  {114,  96,  95, 116, 121, 122},  // 115 (-4, 2)
+  {115,  95,  94, 117, 120, 121},  // 116 (-5, 2)
+  {116,  94,  93, 118, 119, 120},  // 117 (-6, 2)
+  {117,  93,  92, 169, 118, 119},  // 118 (-7, 2)
+  {120, 117, 118, 169, 119, 141},  // 119 (-7, 3)
+  {121, 116, 117, 119, 141, 140},  // 120 (-6, 3)
+  {122, 115, 116, 120, 140, 139},  // 121 (-5, 3)
+  {123, 114, 115, 121, 139, 138},  // 122 (-4, 3)
+  {124, 113, 114, 122, 138, 137},  // 123 (-3, 3)
+  {125, 112, 113, 123, 137, 136},  // 124 (-2, 3)
+  {126, 111, 112, 124, 136, 135},  // 125 (-1, 3)
+  {127, 110, 111, 125, 135, 134},  // 126 ( 0, 3)
+  {128, 109, 110, 126, 134, 133},  // 127 ( 1, 3)
+  {129, 108, 109, 127, 133, 132},  // 128 ( 2, 3)
+  {130, 107, 108, 128, 132, 131},  // 129 ( 3, 3)
+  {169, 106, 107, 129, 131, 130},  // 130 ( 4, 3)
+  {169, 130, 129, 132, 151, 131},  // 131 ( 3, 4)
+  {131, 129, 128, 133, 150, 151},  // 132 ( 2, 4)
+  {132, 128, 127, 134, 149, 150},  // 133 ( 1, 4)
+  {133, 127, 126, 135, 148, 149},  // 134 ( 0, 4)
+  {134, 126, 125, 136, 147, 148},  // 135 (-1, 4)
+  {135, 125, 124, 137, 146, 147},  // 136 (-2, 4)
+  {136, 124, 123, 138, 145, 146},  // 137 (-3, 4)
+  {137, 123, 122, 139, 144, 145},  // 138 (-4, 4)
+  {138, 122, 121, 140, 143, 144},  // 139 (-5, 4)
+  {139, 121, 120, 141, 142, 143},  // 140 (-6, 4)
+  {140, 120, 119, 169, 141, 142},  // 141 (-7, 4)
+  {143, 140, 141, 169, 142, 160},  // 142 (-7, 5)
+  {144, 139, 140, 142, 160, 159},  // 143 (-6, 5)
+  {145, 138, 139, 143, 159, 158},  // 144 (-5, 5)
+  {146, 137, 138, 144, 158, 157},  // 145 (-4, 5)
+  {147, 136, 137, 145, 157, 156},  // 146 (-3, 5)
+  {148, 135, 136, 146, 156, 155},  // 147 (-2, 5)
+  {149, 134, 135, 147, 155, 154},  // 148 (-1, 5)
+  {150, 133, 134, 148, 154, 153},  // 149 ( 0, 5)
+  {151, 132, 133, 149, 153, 152},  // 150 ( 1, 5)
+  {169, 131, 132, 150, 152, 151},  // 151 ( 2, 5)
+  {169, 151, 150, 153, 168, 152},  // 152 ( 1, 6)
+  {152, 150, 149, 154, 167, 168},  // 153 ( 0, 6)
+  {153, 149, 148, 155, 166, 167},  // 154 (-1, 6)
+  {154, 148, 147, 156, 165, 166},  // 155 (-2, 6)
+  {155, 147, 146, 157, 164, 165},  // 156 (-3, 6)
+  {156, 146, 145, 158, 163, 164},  // 157 (-4, 6)
+  {157, 145, 144, 159, 162, 163},  // 158 (-5, 6)
+  {158, 144, 143, 160, 161, 162},  // 159 (-6, 6)
+  {159, 143, 142, 169, 160, 161},  // 160 (-7, 6)
+  {162, 159, 160, 169, 161, 161},  // 161 (-7, 7)
+  {163, 158, 159, 161, 162, 162},  // 162 (-6, 7)
+  {164, 157, 158, 162, 163, 163},  // 163 (-5, 7)
+  {165, 156, 157, 163, 164, 164},  // 164 (-4, 7)
+  {166, 155, 156, 164, 165, 165},  // 165 (-3, 7)
+  {167, 154, 155, 165, 166, 166},  // 166 (-2, 7)
+  {168, 153, 154, 166, 167, 167},  // 167 (-1, 7)
+  {169, 152, 153, 167, 168, 168},  // 168 ( 0, 7)
+};
+
+// ===== State =====
+// Double tampon : +1 pour la cellule fantôme (reste à 0)
+static uint8_t  heat[2][NUM_LEDS + 1];
+static uint8_t  cur = 0;
+static uint32_t lastStep = 0;
+
+// ===== Simulation =====
+// La chaleur monte : chaque cellule reçoit surtout de ses deux voisines du dessous,
+// un peu de ses voisines latérales. Poids 3+3+1+1 = 8 -> division par décalage.
+static void step() {
+  const uint8_t* src = heat[cur];
+  uint8_t*       dst = heat[cur ^ 1];
+
+  for (uint8_t i = 0; i < NUM_LEDS; ++i) {
+    const uint8_t* n = NEIGH[i];
+    uint16_t acc = 3 * (uint16_t)(src[pgm_read_byte(n + D_SW)] + src[pgm_read_byte(n + D_SE)])
+                 +     (uint16_t)(src[pgm_read_byte(n + D_E)]  + src[pgm_read_byte(n + D_W)]);
+    dst[i] = qsub8((uint8_t)(acc >> 3), random8(COOLING_MAX));
+  }
+
+  for (uint8_t k = 0; k < SPARKS_PER_STEP; ++k) {
+    uint8_t i = random8(SPARK_FIRST, NUM_LEDS);
+    dst[i] = qadd8(dst[i], random8(SPARK_MIN, SPARK_MAX));
+  }
+
+  dst[GHOST] = 0;
+  cur ^= 1;
+}
+
+// ===== Public API =====
+void ScenarioFire::begin() {
+  randomSeed(analogRead(A0));
+  for (int i = 0; i <= NUM_LEDS; ++i) {
+    heat[0][i] = 0;
+    heat[1][i] = 0;
+  }
+  cur = 0;
+  lastStep = millis();
+}
+
+void ScenarioFire::tick(uint32_t now) {
+  // Pas fixes : rattrape au plus quelques pas si la boucle a pris du retard
+  uint8_t budget = 4;
+  while ((now - lastStep) >= STEP_MS && budget--) {
+    lastStep += STEP_MS;
+    step();
+  }
+  if ((now - lastStep) >= STEP_MS) lastStep = now;
+
+  const uint8_t* h = heat[cur];
+  for (int i = 0; i < NUM_LEDS; ++i) {
+    leds[i] = HeatColor(h[i]);
+  }
+
+  ledsShow();
+}
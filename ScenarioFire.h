@@ -0,0 +1,9 @@
+#pragma once
+#include "Scenario.h"
+
+// Feu sur le grand hex : diffusion de chaleur vers le haut (stencil 6 voisins), braises en bas
+class ScenarioFire : public Scenario {
+public:
+  void begin() override;
+  void tick(uint32_t now) override;
+};
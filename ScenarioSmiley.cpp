@@ -3,28 +3,48 @@
 #include "Config.h"
 #include "Leds.h"
 #include "ScenarioSmiley.h"
+#include "HexRaster.h"
 
-static constexpr uint8_t SMILE_BRIGHT = 220;
+static constexpr uint8_t  SMILE_BRIGHT = 220;
 
-// Indices à allumer pour le smiley (yeux + bouche)
-static const uint16_t SMILE_IDXS[] = {
-  41, 46,              // yeux
-  115, 122,            // haut de bouche
-  138, 137, 136, 135, 134, 127, 109 // courbe de bouche
+// Démo sprite (SMILEY_DRIFT) : balancement lent, positions sous-LED (256 = 1 LED)
+static constexpr int16_t  DRIFT_Q      = 150;   // amplitude horizontale
+static constexpr int16_t  DRIFT_R      = 90;    // amplitude verticale
+static constexpr int16_t  SCALE_DEPTH  = 16;    // respiration d'échelle (/256)
+static constexpr uint8_t  DRIFT_MS     = 24;    // ms par pas de phase (256 pas ~6 s)
+
+// Smiley en axial, relatif au centre du hex (yeux + bouche)
+static const int8_t SMILE_PTS[][2] PROGMEM = {
+  {-1,-3}, { 4,-3},                                     // yeux
+  {-4, 2}, {-4, 3},                                     // haut de bouche
+  {-4, 4}, {-3, 4}, {-2, 4}, {-1, 4}, { 0, 4}, { 1, 3}, { 2, 2} // courbe de bouche
 };
-static constexpr uint8_t SMILE_COUNT = sizeof(SMILE_IDXS)/sizeof(SMILE_IDXS[0]);
+static constexpr uint8_t SMILE_COUNT = sizeof(SMILE_PTS)/sizeof(SMILE_PTS[0]);
+
+static uint8_t target[NUM_LEDS];
 
 void ScenarioSmiley::begin() {
   randomSeed(analogRead(A0));
 }
 
 void ScenarioSmiley::tick(uint32_t now) {
+  // pose d'origine : centré, 1:1 -> chaque point tombe pile sur une LED, à SMILE_BRIGHT
+  HexPos origin = { 0, 0 };
+  uint16_t scale = 256;
+#if SMILEY_DRIFT
+  uint8_t ph = (uint8_t)(now / DRIFT_MS);
+  origin.q = (int16_t)((((int16_t)sin8(ph) - 128) * DRIFT_Q) / 128);
+  origin.r = (int16_t)((((int16_t)sin8((uint8_t)(ph * 2 + 64)) - 128) * DRIFT_R) / 128);
+  scale += (((int16_t)sin8((uint8_t)(ph * 3)) - 128) * SCALE_DEPTH) / 128;
+#else
+  (void)now;
+#endif
+
+  for (int i = 0; i < NUM_LEDS; ++i) target[i] = 0;
+  hexSprite(target, SMILE_PTS, SMILE_COUNT, origin, scale, SMILE_BRIGHT);
 
-  // Smiley par-dessus le fond
-  for (uint8_t k = 0; k < SMILE_COUNT; ++k) {
-    uint16_t idx = SMILE_IDXS[k];
-    if (idx >= NUM_LEDS) continue;
-    leds[idx] = CRGB(SMILE_BRIGHT, SMILE_BRIGHT, SMILE_BRIGHT);
+  for (int i = 0; i < NUM_LEDS; ++i) {
+    leds[i] = CRGB(target[i], target[i], target[i]);
   }
 
   ledsShow();
@@ -0,0 +1,193 @@
+#include <FastLED.h>
+#include "Config.h"
+#include "Leds.h"
+#include "ScenarioStream.h"
+
+// ===== Protocole =====
+static constexpr uint8_t  MAGIC_0        = 'A';
+static constexpr uint8_t  MAGIC_1        = 'd';
+static constexpr uint8_t  KIND_FULL      = 'a';   // Adalight classique
+static constexpr uint8_t  KIND_PARTIAL   = 'p';   // fenêtre offset/longueur + somme de contrôle
+static constexpr uint8_t  HDR_FULL_LEN   = 3;     // hi lo chk
+static constexpr uint8_t  HDR_PART_LEN   = 6;     // oH oL nH nL flags chk
+static constexpr uint8_t  FLAG_SHOW      = 0x01;
+static constexpr uint8_t  CHK_SALT       = 0x55;
+
+static constexpr uint8_t  ACK_OK         = '+';   // crédit rendu, trame acceptée
+static constexpr uint8_t  ACK_DROP       = '!';   // crédit rendu, trame rejetée
+
+// ===== State =====
+enum class St : uint8_t { MAGIC0, MAGIC1, MAGIC2, HEADER, PAYLOAD, SUM };
+static St       state = St::MAGIC0;
+static uint8_t  kind = 0;
+static uint8_t  hdr[HDR_PART_LEN];
+static uint8_t  hdrLen = 0, hdrPos = 0;
+
+// Tampon arrière : le payload y est reçu, puis la fenêtre [winOff, winOff + winLen) n'est
+// copiée dans leds[] qu'une fois la trame validée (somme, longueur complète)
+static CRGB     staged[NUM_LEDS];
+static uint16_t winOff = 0, winLen = 0;
+
+static uint8_t* dst = nullptr;        // prochain octet à recevoir dans staged[]
+static uint16_t remaining = 0;        // octets RGB restant à recevoir
+static uint8_t  sum = 0;              // somme 8 bits du payload
+static bool     showAtEnd = false;
+static uint32_t lastByteAt = 0;
+static uint16_t rxSinceAck = 0;       // octets reçus depuis le dernier '+'/'!'
+
+// Mesures : trames affichées / rejetées sur la période courante
+static uint16_t framesShown = 0;
+static uint16_t framesDropped = 0;
+static uint32_t statsAt = 0;
+
+// ===== Utils =====
+static void resetParser() {
+  state = St::MAGIC0;
+  hdrPos = 0;
+  remaining = 0;
+  winLen = 0;
+  dst = nullptr;
+}
+
+static void finishFrame(bool ok) {
+  if (ok) {
+    memcpy(&leds[winOff], &staged[winOff], winLen * sizeof(CRGB));
+    if (showAtEnd) {
+      ledsShow();
+      framesShown++;
+    }
+    Serial.write(ACK_OK);             // après show() : l'hôte peut renvoyer sans risque
+  } else {
+    framesDropped++;
+    Serial.write(ACK_DROP);
+  }
+  rxSinceAck = 0;
+  resetParser();
+}
+
+// En-tête complet : valide la somme et la fenêtre, prépare la réception du payload
+static void openFrame() {
+  uint16_t off, n;
+  uint8_t  chk;
+  if (kind == KIND_FULL) {
+    chk       = hdr[0] ^ hdr[1] ^ CHK_SALT;
+    off       = 0;
+    n         = (uint16_t)(((uint16_t)hdr[0] << 8) | hdr[1]) + 1;
+    showAtEnd = true;
+  } else {
+    chk       = hdr[0] ^ hdr[1] ^ hdr[2] ^ hdr[3] ^ hdr[4] ^ CHK_SALT;
+    off       = ((uint16_t)hdr[0] << 8) | hdr[1];
+    n         = ((uint16_t)hdr[2] << 8) | hdr[3];
+    showAtEnd = (hdr[4] & FLAG_SHOW) != 0;
+  }
+  if (chk != hdr[hdrLen - 1] || n == 0 || (uint32_t)off + n > NUM_LEDS) {
+    finishFrame(false);
+    return;
+  }
+  winOff    = off;
+  winLen    = n;
+  dst       = (uint8_t*)&staged[off]; // CRGB = r,g,b consécutifs
+  remaining = n * 3;
+  sum       = 0;
+  state     = St::PAYLOAD;
+}
+
+// Lit ce qui est disponible sans jamais bloquer
+static void pump() {
+  int avail;
+  while ((avail = Serial.available()) > 0) {
+    if (state == St::PAYLOAD) {
+      uint16_t want = remaining < (uint16_t)avail ? remaining : (uint16_t)avail;
+      uint16_t got  = (uint16_t)Serial.readBytes(dst, want);
+      rxSinceAck += got;
+      for (uint16_t k = 0; k < got; ++k) sum += dst[k];
+      dst       += got;
+      remaining -= got;
+      if (remaining == 0) {
+        if (kind == KIND_FULL) finishFrame(true);
+        else                   state = St::SUM;
+      }
+      continue;
+    }
+
+    uint8_t c = (uint8_t)Serial.read();
+    if (rxSinceAck < 0xFFFF) rxSinceAck++;
+    switch (state) {
+      case St::MAGIC0:
+        if (c == MAGIC_0) state = St::MAGIC1;
+        break;
+      case St::MAGIC1:
+        state = (c == MAGIC_1) ? St::MAGIC2 : (c == MAGIC_0 ? St::MAGIC1 : St::MAGIC0);
+        break;
+      case St::MAGIC2:
+        if (c == KIND_FULL || c == KIND_PARTIAL) {
+          // octets orphelins avant ce magic (trame dont le magic a été perdu, suivie sans
+          // silence par celle-ci) : leur crédit est rendu avant de traiter la nouvelle trame
+          if (rxSinceAck > 3) {
+            framesDropped++;
+            Serial.write(ACK_DROP);
+          }
+          rxSinceAck = 3;
+          kind   = c;
+          hdrLen = (c == KIND_FULL) ? HDR_FULL_LEN : HDR_PART_LEN;
+          hdrPos = 0;
+          state  = St::HEADER;
+        } else {
+          state = (c == MAGIC_0) ? St::MAGIC1 : St::MAGIC0;
+        }
+        break;
+      case St::HEADER:
+        hdr[hdrPos++] = c;
+        if (hdrPos >= hdrLen) openFrame();
+        break;
+      case St::SUM:
+        finishFrame(c == sum);
+        break;
+      default:
+        resetParser();
+        break;
+    }
+  }
+}
+
+// ===== Public API =====
+void ScenarioStream::begin() {
+  Serial.begin(STREAM_BAUD);
+  resetParser();
+  framesShown = 0;
+  framesDropped = 0;
+  rxSinceAck = 0;
+  lastByteAt = statsAt = millis();
+
+  Serial.print(F("Ada\n"));
+  for (uint8_t i = 0; i < STREAM_WINDOW; ++i) Serial.write(ACK_OK); // crédits initiaux
+}
+
+void ScenarioStream::tick(uint32_t now) {
+  if (Serial.available() > 0) {
+    lastByteAt = now;
+    pump();
+  } else if ((now - lastByteAt) >= STREAM_TIMEOUT_MS) {
+    // trame tronquée, ou octets sans magic valide (en-tête corrompu) : l'hôte a dépensé
+    // un crédit, on le rend ; silence complet depuis le dernier ack : rien à rendre
+    if (state >= St::HEADER || rxSinceAck > 0) finishFrame(false);
+    else                                       resetParser();
+  }
+
+  #if STREAM_STATS_MS > 0
+    if ((now - statsAt) >= STREAM_STATS_MS) {
+      uint32_t dt = now - statsAt;
+      Serial.print(F("#fps="));
+      Serial.print((uint32_t)framesShown * 1000UL / dt);
+      Serial.print(F(" drop="));
+      Serial.print((uint32_t)framesDropped);
+      // plus rien en vol côté LEDs : l'hôte peut remettre ses crédits à STREAM_WINDOW
+      // (filet de sécurité si deux trames perdues ont fusionné en un seul '!')
+      bool idle = state == St::MAGIC0 && rxSinceAck == 0 && (now - lastByteAt) >= STREAM_TIMEOUT_MS;
+      Serial.print(idle ? F(" idle=1\n") : F(" idle=0\n"));
+      framesShown = 0;
+      framesDropped = 0;
+      statsAt = now;
+    }
+  #endif
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "Scenario.h"
+
+// Affichage piloté par l'hôte : trames RGB reçues sur le port série (UART/USB-CDC) dans un
+// tampon arrière, copiées dans leds[] puis affichées seulement si la trame est valide.
+//
+// Hôte -> LEDs
+//   Trame complète (Adalight) : 'A' 'd' 'a' hi lo chk           + 3*(n) octets RGB
+//     n = (hi<<8 | lo) + 1, départ à la LED 0, chk = hi ^ lo ^ 0x55, affichée à la fin.
+//   Trame partielle           : 'A' 'd' 'p' oH oL nH nL flags chk + 3*n octets RGB + sum
+//     off = oH<<8 | oL, n = nH<<8 | nL, chk = oH ^ oL ^ nH ^ nL ^ flags ^ 0x55,
+//     sum = somme 8 bits des octets RGB, flags bit0 = afficher à la fin de la trame.
+//
+// LEDs -> hôte
+//   "Ada\n" au démarrage puis STREAM_WINDOW crédits initiaux.
+//   '+' trame acceptée / '!' trame rejetée : chaque octet rend un crédit à l'hôte,
+//   qui n'envoie une trame que s'il en détient un (fenêtre glissante).
+//   Après STREAM_TIMEOUT_MS de silence, '!' si des octets sont arrivés depuis le dernier
+//   ack sans former de trame complète (magic ou en-tête corrompu) ; de même si un magic valide
+//   arrive après de tels octets orphelins : le crédit de la trame perdue n'est jamais perdu.
+//   "#fps=<n> drop=<n> idle=<0|1>\n" toutes les STREAM_STATS_MS ; idle=1 : rien en vol
+//   depuis STREAM_TIMEOUT_MS, l'hôte qui n'a rien envoyé entre-temps peut remettre ses
+//   crédits à la fenêtre initiale (resynchronisation, ex. deux trames perdues d'affilée).
+class ScenarioStream : public Scenario {
+public:
+  void begin() override;
+  void tick(uint32_t now) override;
+};
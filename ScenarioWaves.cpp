@@ -3,6 +3,9 @@
 #include "Leds.h"
 #include "ScenarioWaves.h"
 #include "Background.h"
+#include "EffectPool.h"
+#include "SpawnWheel.h"
+#include "HexRaster.h"
 
 // ===== Tuning =====
 static constexpr uint8_t  WAVE_PEAK          = 230;   // intensité crête de la tête
@@ -25,27 +28,15 @@ static constexpr uint8_t  WAVE_SLOTS         = 3;
 static constexpr uint8_t  ATTACK_ALPHA_256   = 220;   // montée (allumage) -> fade rapide
 static constexpr uint8_t  DECAY_ALPHA_256    = 80;    // descente (extinction) -> plus doux
 
-// ===== Grid =====
-static constexpr int R = 7;                         // rayon du grand hex (8 par côté -> R=7)
-static constexpr int SIDE = 2*R+1;                  // 15
-static constexpr int INVALID = -1;
-
-struct Axial { int8_t q, r; };
-static Axial coords[NUM_LEDS];
-static int16_t idxMap[SIDE][SIDE];
-
 // ===== State =====
 static uint8_t baseVals[NUM_LEDS];
 static uint8_t smoothVals[NUM_LEDS];   // EMA asymétrique (sortie finale)
 
 struct Wave {
-  bool     inUse = false;
-  uint32_t start = 0;
   int16_t  seedIdx = -1;
   uint8_t  maxDist = 0;
 };
-static Wave waves[WAVE_SLOTS];
-static uint32_t nextSpawnAt = 0;
+static EffectPool<Wave, WAVE_SLOTS> waves;
 
 // ===== Utils =====
 static uint8_t clamp8i(int v){ return v<0?0:(v>255?255:v); }
@@ -59,57 +50,10 @@ static float raisedCosine(float x, float c, float w){
   return 0.5f * (1.0f + cosf(3.14159265f * t));
 }
 
-static inline bool validCoord(int q, int r){
-  return (abs(q) <= R) && (abs(r) <= R) && (abs(q + r) <= R);
-}
-static int idxOf(int q, int r){
-  if (!validCoord(q, r)) return INVALID;
-  return idxMap[q + R][r + R];
-}
-static uint8_t hexDistance(const Axial& a, const Axial& b){
-  int dq = a.q - b.q;
-  int dr = a.r - b.r;
-  int ds = -(a.q + a.r) - (-(b.q + b.r));
-  dq = abs(dq); dr = abs(dr); ds = abs(ds);
-  return (uint8_t)((dq + dr + ds) / 2);
-}
-
-static void buildGridMapping(){
-  for (int i = 0; i < SIDE; ++i)
-    for (int j = 0; j < SIDE; ++j)
-      idxMap[i][j] = INVALID;
-
-  struct Tile { int q, r; };
-  Tile tiles[NUM_LEDS];
-  int n = 0, rowIdx = 0;
-  int rowStart[2*R+1];
-  int rowLen[2*R+1];
-
-  for (int r = -R; r <= R; ++r) {
-    int q1 = max(-R, -r - R);
-    int q2 = min(R,  -r + R);
-    rowStart[rowIdx] = n;
-    rowLen[rowIdx]   = q2 - q1 + 1;
-    for (int q = q1; q <= q2; ++q) tiles[n++] = {q, r};
-    rowIdx++;
-  }
-  for (int i = 0; i < rowIdx; ++i) {
-    if (i % 2 == 1) {
-      int s = rowStart[i], e = s + rowLen[i] - 1;
-      while (s < e) { Tile t = tiles[s]; tiles[s] = tiles[e]; tiles[e] = t; s++; e--; }
-    }
-  }
-  for (int i = 0; i < NUM_LEDS; ++i) {
-    coords[i].q = (int8_t)tiles[i].q;
-    coords[i].r = (int8_t)tiles[i].r;
-    idxMap[tiles[i].q + R][tiles[i].r + R] = i;
-  }
-}
-
 static uint8_t maxDistanceToEdge(int seed){
   uint8_t md = 0;
   for (int i = 0; i < NUM_LEDS; ++i) {
-    uint8_t d = hexDistance(coords[i], coords[seed]);
+    uint8_t d = hexDistance(hexCoord(i), hexCoord(seed));
     if (d > md) md = d;
   }
   return md;
@@ -125,27 +69,24 @@ static uint32_t weightedRandomWait() {
 }
 
 static void trySpawnWave(uint32_t now){
-  for (uint8_t i = 0; i < WAVE_SLOTS; ++i) {
-    if (!waves[i].inUse) {
-      waves[i].inUse   = true;
-      waves[i].start   = now - (uint16_t)random(0, PER_RING_DELAY/2 + 1);
-      waves[i].seedIdx = random(NUM_LEDS);
-      waves[i].maxDist = maxDistanceToEdge(waves[i].seedIdx);
-      nextSpawnAt = now + weightedRandomWait();
-      return;
-    }
+  int16_t w = waves.acquire(now - (uint16_t)random(0, PER_RING_DELAY/2 + 1));
+  if (w >= 0) {
+    waves[w].seedIdx = random(NUM_LEDS);
+    waves[w].maxDist = maxDistanceToEdge(waves[w].seedIdx);
   }
-  nextSpawnAt = now + weightedRandomWait();
+  // si aucun slot libre, reporte simplement le prochain spawn
+  spawnWheel.schedule(now + weightedRandomWait(), SPAWN_WAVES);
 }
 
 // ===== Public API =====
 void ScenarioWaves::begin() {
-  buildGridMapping();
   randomSeed(analogRead(A0));
-  for (uint8_t i = 0; i < WAVE_SLOTS; ++i) waves[i] = Wave{};
+  waves.clear();
   for (int i = 0; i < NUM_LEDS; ++i) smoothVals[i] = 0;
   backgroundBegin(); // initialise le fond
-  nextSpawnAt = millis() + weightedRandomWait();
+  uint32_t now = millis();
+  spawnWheel.clear(now);
+  spawnWheel.schedule(now + weightedRandomWait(), SPAWN_WAVES);
 }
 
 void ScenarioWaves::tick(uint32_t now){
@@ -156,7 +97,7 @@ void ScenarioWaves::tick(uint32_t now){
   }
 
   // 2) Spawns
-  if ((int32_t)(now - nextSpawnAt) >= 0) {
+  while (spawnWheel.poll(now) >= 0) {
     trySpawnWave(now);
   }
 
@@ -164,21 +105,28 @@ void ScenarioWaves::tick(uint32_t now){
   static uint8_t target[NUM_LEDS];
   for (int i = 0; i < NUM_LEDS; ++i) target[i] = baseVals[i];
 
-  for (uint8_t w = 0; w < WAVE_SLOTS; ++w) {
-    if (!waves[w].inUse) continue;
+  for (uint8_t k = waves.size(); k-- > 0;) {
+    uint8_t w = waves.slotAt(k);
 
-    uint32_t t = now - waves[w].start;
+    uint32_t t = now - waves.start(w);
     float head = (float)t / (float)PER_RING_DELAY; // position radiale continue
 
     if (head > (float)waves[w].maxDist + TRAIL_HEX + (HEAD_WIDTH*0.5f)) {
-      waves[w].inUse = false;
+      waves.release(w);
       continue;
     }
 
-    const Axial seed = coords[waves[w].seedIdx];
+    const Axial seed = hexCoord(waves[w].seedIdx);
+
+    // seuls les anneaux à distance [head - TRAIL_HEX, head + FRONT_HEX] contribuent ;
+    // l'enveloppe ne dépend que de la distance -> calculée une fois par anneau
+    int kMin = (int)ceilf(head - TRAIL_HEX);
+    int kMax = (int)(head + FRONT_HEX);
+    if (kMin < 0) kMin = 0;
+    if (kMax > HEX_RING_MAX) kMax = HEX_RING_MAX;
 
-    for (int i = 0; i < NUM_LEDS; ++i) {
-      float d = (float)hexDistance(coords[i], seed);
+    for (int k = kMin; k <= kMax; ++k) {
+      float d = (float)k;
 
       float wHead  = raisedCosine(d, head, HEAD_WIDTH);  // 0..1
       int   vHead  = (int)(wHead * (float)WAVE_PEAK);
@@ -199,8 +147,11 @@ void ScenarioWaves::tick(uint32_t now){
       }
       int vFront = (int)(wFront * (float)(WAVE_PEAK * FRONT_FACTOR));
 
-      uint8_t v = (uint8_t)max((int)target[i], max(vHead, max(vTrail, vFront)));
-      target[i] = v;
+      uint8_t v = (uint8_t)max(vHead, max(vTrail, vFront));
+      if (v == 0) continue;
+      hexForRing(seed.q, seed.r, k, [&](int i, uint8_t) {
+        if (v > target[i]) target[i] = v;
+      });
     }
   }
 
@@ -0,0 +1,57 @@
+#include "SpawnWheel.h"
+
+SpawnWheel spawnWheel;
+
+static_assert((SpawnWheel::BUCKETS & (SpawnWheel::BUCKETS - 1)) == 0, "BUCKETS doit être une puissance de 2");
+
+// _cursor est gardé en ms (aligné sur une case) : les différences 32 bits restent
+// correctes au débordement de millis(), comme (int32_t)(now - at) dans les scénarios.
+static constexpr uint32_t TICK_MS   = 1UL << SpawnWheel::TICK_MS_SHIFT;
+static constexpr uint32_t WHEEL_MS  = TICK_MS * SpawnWheel::BUCKETS;
+
+static inline uint8_t bucketOf(uint32_t ms) {
+  return (ms >> SpawnWheel::TICK_MS_SHIFT) & (SpawnWheel::BUCKETS - 1);
+}
+
+void SpawnWheel::clear(uint32_t now) {
+  for (uint8_t b = 0; b < BUCKETS; ++b) _head[b] = NIL;
+  for (uint8_t e = 0; e < CAPACITY; ++e) _next[e] = (e + 1 < CAPACITY) ? e + 1 : NIL;
+  _free = 0;
+  _cursor = now & ~(TICK_MS - 1);
+}
+
+bool SpawnWheel::schedule(uint32_t at, uint8_t tag) {
+  if (_free == NIL) return false;
+  uint8_t e = _free;
+  _free = _next[e];
+  _at[e]  = at;
+  _tag[e] = tag;
+
+  // une échéance déjà passée tombe dans la case courante -> traitée au prochain poll()
+  uint8_t b = bucketOf(((int32_t)(at - _cursor) < 0) ? _cursor : at);
+  _next[e] = _head[b];
+  _head[b] = e;
+  return true;
+}
+
+int16_t SpawnWheel::poll(uint32_t now) {
+  uint32_t nowCase = now & ~(TICK_MS - 1);
+  if ((int32_t)(nowCase - _cursor) < 0) return -1;
+  // longue absence (scénario inactif) : un seul tour de roue suffit à tout revoir
+  if (nowCase - _cursor > WHEEL_MS) _cursor = nowCase - WHEEL_MS;
+
+  for (;;) {
+    uint8_t b = bucketOf(_cursor);
+    uint8_t prev = NIL;
+    for (uint8_t e = _head[b]; e != NIL; prev = e, e = _next[e]) {
+      if ((int32_t)(now - _at[e]) < 0) continue;      // tour suivant
+      if (prev == NIL) _head[b] = _next[e];
+      else             _next[prev] = _next[e];
+      _next[e] = _free;
+      _free = e;
+      return _tag[e];
+    }
+    if (_cursor == nowCase) return -1;                // la case courante sera revue au prochain appel
+    _cursor += TICK_MS;
+  }
+}
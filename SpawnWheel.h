@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+
+// Ordonnanceur de spawns sur roue temporelle (hashed timing wheel).
+// Chaque événement porte un tag défini par le scénario ; poll() ne visite que les cases
+// franchies depuis l'appel précédent, quel que soit le nombre d'événements en attente.
+// Les échéances au-delà d'un tour de roue restent dans leur case jusqu'à ce qu'elles échoient.
+//
+// Une seule roue pour tout le firmware (spawnWheel) : un seul scénario tourne à la fois et
+// chacun la vide dans begin(). Chaque scénario n'a qu'une échéance en attente (la suivante
+// est planifiée quand elle échoit), d'où la petite capacité.
+class SpawnWheel {
+public:
+  static constexpr uint8_t BUCKETS       = 16;   // puissance de 2
+  static constexpr uint8_t CAPACITY      = 4;    // événements en attente simultanés
+  static constexpr uint8_t TICK_MS_SHIFT = 5;    // 32 ms par case -> ~0.5 s par tour
+
+  void    clear(uint32_t now);
+  bool    schedule(uint32_t at, uint8_t tag);    // false si plus de place
+  int16_t poll(uint32_t now);                    // tag d'un événement échu (retiré), ou -1
+
+private:
+  static constexpr uint8_t NIL = 0xFF;
+
+  uint32_t _at[CAPACITY];
+  uint8_t  _tag[CAPACITY];
+  uint8_t  _next[CAPACITY];
+  uint8_t  _head[BUCKETS];
+  uint8_t  _free = NIL;
+  uint32_t _cursor = 0;                          // début de la case courante, en ms
+};
+
+// Tag = scénario propriétaire de l'échéance
+enum SpawnTag : uint8_t { SPAWN_WAVES = 1, SPAWN_WORMS, SPAWN_FX };
+
+extern SpawnWheel spawnWheel;
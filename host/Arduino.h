@@ -0,0 +1,66 @@
+#pragma once
+// Arduino.h de substitution pour les outils hôte (host/) : juste ce que le sketch utilise.
+// Horloge, entrée analogique et port série sont pilotés par le harnais (voir Host.h).
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define HIGH          1
+#define LOW           0
+#define INPUT         0
+#define INPUT_PULLUP  2
+#define A0            14
+#define A1            15
+
+#ifndef F_CPU
+  #define F_CPU       16000000UL
+#endif
+
+#define PROGMEM
+#define pgm_read_byte(p)  (*(const uint8_t*)(p))
+#define pgm_read_word(p)  (*(const uint16_t*)(p))
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+
+typedef uint8_t byte;
+
+uint32_t millis();
+uint32_t micros();
+void     delay(uint32_t ms);
+
+int  analogRead(uint8_t pin);
+int  digitalRead(uint8_t pin);
+void pinMode(uint8_t pin, uint8_t mode);
+
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+template <class T> inline T max(T a, T b) { return a > b ? a : b; }
+template <class T> inline T min(T a, T b) { return a < b ? a : b; }
+
+class HardwareSerial {
+public:
+  void   begin(unsigned long baud);
+  int    available();
+  int    read();
+  size_t readBytes(uint8_t* buf, size_t n);
+  size_t readBytes(char* buf, size_t n) { return readBytes((uint8_t*)buf, n); }
+  size_t write(uint8_t c);
+  size_t write(const uint8_t* buf, size_t n);
+  size_t print(const __FlashStringHelper* s) { return print((const char*)s); }
+  size_t print(const char* s);
+  size_t print(unsigned long v);
+  size_t println(const __FlashStringHelper* s) { return print(s) + println(); }
+  size_t println(const char* s) { return print(s) + println(); }
+  size_t println(unsigned long v) { return print(v) + println(); }
+  size_t println() { return write('\n'); }
+  void   flush() {}
+};
+extern HardwareSerial Serial;
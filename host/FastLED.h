@@ -0,0 +1,47 @@
+#pragma once
+// FastLED.h de substitution pour les outils hôte : CRGB et les fonctions 8 bits utilisées
+// par le sketch. show() ne fait qu'appeler le rappel du harnais (voir Host.h).
+#include <Arduino.h>
+
+struct CRGB {
+  uint8_t r, g, b;
+  CRGB() : r(0), g(0), b(0) {}
+  CRGB(uint8_t r_, uint8_t g_, uint8_t b_) : r(r_), g(g_), b(b_) {}
+};
+
+#define WS2812B        0
+#define GRB            0
+#define BINARY_DITHER  1
+#define Candle         0xFF9329
+#define Tungsten40W    0xFFC58F
+#define Halogen        0xFFF1E0
+#define Neutral        0xFFFFFF
+#define Daylight       0xFFFFFF
+#define Overcast       0xC9E2FF
+#define ClearBlueSky   0x409CFF
+
+uint8_t qadd8(uint8_t a, uint8_t b);
+uint8_t qsub8(uint8_t a, uint8_t b);
+uint8_t scale8(uint8_t i, uint8_t scale);
+uint8_t sin8(uint8_t theta);
+uint8_t ease8InOutCubic(uint8_t i);
+uint8_t inoise8(uint16_t x, uint16_t y);
+uint8_t random8();
+uint8_t random8(uint8_t lim);
+uint8_t random8(uint8_t lo, uint8_t hi);
+CRGB    HeatColor(uint8_t temperature);
+
+class CFastLED {
+public:
+  template <int TYPE, int PIN, int ORDER>
+  void addLeds(CRGB* data, int count) { _leds = data; _count = count; }
+  void setBrightness(uint8_t) {}
+  void setTemperature(uint32_t) {}
+  void setDither(uint8_t) {}
+  void show();
+  void clear(bool writeData = false);
+private:
+  CRGB* _leds = nullptr;
+  int   _count = 0;
+};
+extern CFastLED FastLED;
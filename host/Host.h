@@ -0,0 +1,23 @@
+#pragma once
+#include <FastLED.h>
+
+// Harnais hôte : compile les fichiers du sketch tels quels contre host/Arduino.h et
+// host/FastLED.h, et expose ici ce que la carte fournirait (temps, micro, port série, LEDs).
+
+// Horloge : temps réel (défaut) ou virtuel. En virtuel, micros() avance de HOST_US_PER_CALL
+// à chaque appel (les boucles d'attente active du sketch progressent) et hostAdvanceUs()
+// avance explicitement.
+static constexpr uint32_t HOST_US_PER_CALL = 1;
+void hostUseVirtualClock();
+void hostAdvanceUs(uint32_t us);
+
+// Entrée analogique : f(pin, t_us) -> 0..1023 (défaut : 512 = silence)
+typedef int (*HostAnalogFn)(uint8_t pin, uint32_t tUs);
+void hostSetAnalog(HostAnalogFn f);
+
+// Port série : lecture/écriture sur un descripteur (pty, fichier...) ; -1 = déconnecté
+void hostSerialAttach(int fdIn, int fdOut);
+
+// Appelé à chaque FastLED.show()
+typedef void (*HostShowFn)(const CRGB* leds, int count);
+void hostOnShow(HostShowFn f);
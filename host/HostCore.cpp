@@ -0,0 +1,154 @@
+// Implémentation des substituts Arduino/FastLED pour les outils hôte
+#include <Arduino.h>
+#include <FastLED.h>
+#include <chrono>
+#include <thread>
+#include <cerrno>
+#include <cstdio>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include "Host.h"
+
+// ===== Temps =====
+static bool     virtualClock = false;
+static uint64_t virtualUs = 0;
+static const auto t0 = std::chrono::steady_clock::now();
+
+void hostUseVirtualClock() { virtualClock = true; }
+void hostAdvanceUs(uint32_t us) { virtualUs += us; }
+
+static uint64_t nowUs() {
+  if (virtualClock) return virtualUs += HOST_US_PER_CALL;
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - t0).count();
+}
+
+uint32_t micros() { return (uint32_t)nowUs(); }
+uint32_t millis() { return (uint32_t)(nowUs() / 1000); }
+void delay(uint32_t ms) {
+  if (virtualClock) virtualUs += (uint64_t)ms * 1000;
+  else              std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// ===== E/S =====
+static HostAnalogFn analogFn = nullptr;
+void hostSetAnalog(HostAnalogFn f) { analogFn = f; }
+int analogRead(uint8_t pin) { return analogFn ? analogFn(pin, (uint32_t)nowUs()) : 512; }
+int digitalRead(uint8_t) { return HIGH; }   // bouton relâché (pull-up)
+void pinMode(uint8_t, uint8_t) {}
+
+long random(long howBig) { return howBig > 0 ? rand() % howBig : 0; }
+long random(long lo, long hi) { return hi > lo ? lo + random(hi - lo) : lo; }
+void randomSeed(unsigned long seed) { srand((unsigned)seed); }
+
+// ===== Série =====
+HardwareSerial Serial;
+static int serIn = -1, serOut = -1;
+static int peeked = -1;
+
+void hostSerialAttach(int fdIn, int fdOut) {
+  serIn = fdIn;
+  serOut = fdOut;
+  if (serIn >= 0) fcntl(serIn, F_SETFL, fcntl(serIn, F_GETFL) | O_NONBLOCK);
+}
+
+void HardwareSerial::begin(unsigned long) {}
+
+int HardwareSerial::available() {
+  if (peeked >= 0) return 1;
+  if (serIn < 0) return 0;
+  uint8_t c;
+  if (::read(serIn, &c, 1) == 1) { peeked = c; return 1; }
+  return 0;
+}
+
+int HardwareSerial::read() {
+  if (!available()) return -1;
+  int c = peeked;
+  peeked = -1;
+  return c;
+}
+
+size_t HardwareSerial::readBytes(uint8_t* buf, size_t n) {
+  size_t got = 0;
+  while (got < n && available()) buf[got++] = (uint8_t)read();
+  return got;
+}
+
+size_t HardwareSerial::write(const uint8_t* buf, size_t n) {
+  if (serOut < 0) return n;
+  size_t done = 0;
+  while (done < n) {
+    ssize_t w = ::write(serOut, buf + done, n - done);
+    if (w > 0) { done += (size_t)w; continue; }
+    if (w < 0 && errno != EAGAIN) break;
+    pollfd p = { serOut, POLLOUT, 0 };
+    poll(&p, 1, 10);
+  }
+  return done;
+}
+
+size_t HardwareSerial::write(uint8_t c) { return write(&c, 1); }
+size_t HardwareSerial::print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+size_t HardwareSerial::print(unsigned long v) {
+  char b[12];
+  snprintf(b, sizeof(b), "%lu", v);
+  return print(b);
+}
+
+// ===== FastLED =====
+CFastLED FastLED;
+static HostShowFn showFn = nullptr;
+void hostOnShow(HostShowFn f) { showFn = f; }
+
+void CFastLED::show() { if (showFn && _leds) showFn(_leds, _count); }
+void CFastLED::clear(bool writeData) {
+  for (int i = 0; i < _count; ++i) _leds[i] = CRGB(0, 0, 0);
+  if (writeData) show();
+}
+
+uint8_t qadd8(uint8_t a, uint8_t b) { unsigned s = a + b; return s > 255 ? 255 : s; }
+uint8_t qsub8(uint8_t a, uint8_t b) { return a > b ? a - b : 0; }
+uint8_t scale8(uint8_t i, uint8_t scale) { return (uint8_t)(((uint16_t)i * (1 + scale)) >> 8); }
+
+uint8_t sin8(uint8_t theta) {
+  return (uint8_t)lround(128.0 + 127.5 * sin(theta * (2.0 * M_PI / 256.0)) - 0.5);
+}
+
+uint8_t ease8InOutCubic(uint8_t i) {
+  // 3x^2 - 2x^3, comme FastLED
+  uint8_t ii  = scale8(i, i);
+  uint8_t iii = scale8(ii, i);
+  uint16_t r1 = (3 * (uint16_t)ii) - (2 * (uint16_t)iii);
+  return r1 & 0x100 ? 255 : (uint8_t)r1;
+}
+
+// Bruit de valeur 2D lissé : pas le Perlin de FastLED, mais même plage et même douceur
+static uint8_t lattice(uint16_t x, uint16_t y) {
+  uint32_t h = x * 374761393u + y * 668265263u;
+  h = (h ^ (h >> 13)) * 1274126177u;
+  return (uint8_t)(h >> 24);
+}
+uint8_t inoise8(uint16_t x, uint16_t y) {
+  uint16_t xi = x >> 8, yi = y >> 8;
+  float fx = (x & 0xFF) / 256.0f, fy = (y & 0xFF) / 256.0f;
+  fx = fx * fx * (3 - 2 * fx);
+  fy = fy * fy * (3 - 2 * fy);
+  float a = lattice(xi, yi),     b = lattice(xi + 1, yi);
+  float c = lattice(xi, yi + 1), d = lattice(xi + 1, yi + 1);
+  float v = (a + (b - a) * fx) + ((c + (d - c) * fx) - (a + (b - a) * fx)) * fy;
+  return (uint8_t)v;
+}
+
+uint8_t random8() { return (uint8_t)rand(); }
+uint8_t random8(uint8_t lim) { return lim ? (uint8_t)(rand() % lim) : 0; }
+uint8_t random8(uint8_t lo, uint8_t hi) { return hi > lo ? lo + random8(hi - lo) : lo; }
+
+CRGB HeatColor(uint8_t temperature) {
+  uint8_t t192 = scale8(temperature, 191);
+  uint8_t heatramp = (uint8_t)((t192 & 0x3F) << 2);
+  if (t192 & 0x80) return CRGB(255, 255, heatramp);
+  if (t192 & 0x40) return CRGB(255, heatramp, 0);
+  return CRGB(heatramp, 0, 0);
+}
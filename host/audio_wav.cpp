@@ -0,0 +1,141 @@
+// Lecteur WAV pour ScenarioAudio : le scénario tourne sur l'hôte en horloge virtuelle et
+// analogRead(PIN_MIC) renvoie l'échantillon du fichier à l'instant virtuel courant, comme le
+// ferait le micro (sortie centrée sur 512). Une ligne par trame sur stdout :
+//   t_ms  anneau0 .. anneau7
+//
+//   host/build/audio_wav fichier.wav [--gain G] [--frames N]   (PCM 16 bits, mono ou stéréo)
+//   host/build/audio_wav --tone HZ [AMP] [--frames N]           (sinus synthétique, AMP 0..511)
+#include <Arduino.h>
+#include <FastLED.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "Host.h"
+#include "../Config.h"
+#include "../Leds.h"
+#include "../HexGrid.h"
+#include "../ScenarioAudio.h"
+
+static std::vector<int16_t> pcm;       // mono
+static uint32_t pcmRate = 0;
+static float    gain    = 1.0f;
+static float    toneHz  = 0.0f;
+static float    toneAmp = 200.0f;
+static uint32_t endUs   = 0xFFFFFFFFUL;
+
+static uint32_t le32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static uint16_t le16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+
+// RIFF/WAVE, PCM 16 bits ; les canaux sont moyennés. false (message sur stderr) sinon.
+static bool loadWav(const char* path) {
+  FILE* f = fopen(path, "rb");
+  if (!f) { perror(path); return false; }
+  std::vector<uint8_t> buf;
+  uint8_t tmp[4096];
+  size_t n;
+  while ((n = fread(tmp, 1, sizeof tmp, f)) > 0) buf.insert(buf.end(), tmp, tmp + n);
+  fclose(f);
+
+  if (buf.size() < 12 || memcmp(&buf[0], "RIFF", 4) || memcmp(&buf[8], "WAVE", 4)) {
+    fprintf(stderr, "%s: pas un fichier RIFF/WAVE\n", path);
+    return false;
+  }
+  uint16_t channels = 0, bits = 0, format = 0;
+  size_t pos = 12;
+  while (pos + 8 <= buf.size()) {
+    uint32_t len = le32(&buf[pos + 4]);
+    const uint8_t* body = &buf[pos + 8];
+    size_t avail = buf.size() - (pos + 8);
+    if (len > avail) len = avail;                      // fichier tronqué : on garde ce qui est là
+    if (!memcmp(&buf[pos], "fmt ", 4) && len >= 16) {
+      format   = le16(body);
+      channels = le16(body + 2);
+      pcmRate  = le32(body + 4);
+      bits     = le16(body + 14);
+    } else if (!memcmp(&buf[pos], "data", 4)) {
+      if (format != 1 || bits != 16 || channels == 0 || pcmRate == 0) {
+        fprintf(stderr, "%s: PCM 16 bits attendu (format=%u bits=%u)\n", path, format, bits);
+        return false;
+      }
+      size_t frames = len / (2u * channels);
+      pcm.resize(frames);
+      for (size_t i = 0; i < frames; ++i) {
+        int32_t acc = 0;
+        for (uint16_t c = 0; c < channels; ++c) acc += (int16_t)le16(body + 2 * (i * channels + c));
+        pcm[i] = (int16_t)(acc / channels);
+      }
+      return true;
+    }
+    pos += 8 + len + (len & 1);
+  }
+  fprintf(stderr, "%s: pas de bloc data\n", path);
+  return false;
+}
+
+static int micWav(uint8_t pin, uint32_t tUs) {
+  if (pin != PIN_MIC) return 512;
+  size_t i = (size_t)((uint64_t)tUs * pcmRate / 1000000UL);
+  if (i >= pcm.size()) return 512;
+  int v = 512 + (int)lroundf(pcm[i] / 64.0f * gain);  // ±32768 -> ±512
+  return v < 0 ? 0 : (v > 1023 ? 1023 : v);
+}
+
+static int micTone(uint8_t pin, uint32_t tUs) {
+  if (pin != PIN_MIC) return 512;
+  return 512 + (int)lroundf(toneAmp * sinf(6.2831853f * toneHz * tUs * 1e-6f));
+}
+
+// anneau r lu sur la LED (r, 0) : toutes les LEDs d'un anneau ont la même valeur
+static void onShow(const CRGB* l, int) {
+  printf("%8.1f", micros() / 1000.0);
+  for (int r = 0; r <= HEX_R; ++r) printf(" %3u", l[hexIndex(r, 0)].r);
+  printf("\n");
+}
+
+static void usage() {
+  fprintf(stderr, "usage: audio_wav fichier.wav [--gain G] [--frames N]\n"
+                  "       audio_wav --tone HZ [AMP] [--frames N]\n");
+  exit(2);
+}
+
+int main(int argc, char** argv) {
+  const char* path = nullptr;
+  long frames = -1;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--frames") && i + 1 < argc)    frames = atol(argv[++i]);
+    else if (!strcmp(argv[i], "--gain") && i + 1 < argc) gain = (float)atof(argv[++i]);
+    else if (!strcmp(argv[i], "--tone") && i + 1 < argc) {
+      toneHz = (float)atof(argv[++i]);
+      if (i + 1 < argc && argv[i + 1][0] != '-') toneAmp = (float)atof(argv[++i]);
+    }
+    else if (argv[i][0] != '-' && !path)                 path = argv[i];
+    else usage();
+  }
+  if (!path && toneHz <= 0) usage();
+
+  if (path) {
+    if (!loadWav(path)) return 1;
+    endUs = (uint32_t)((uint64_t)pcm.size() * 1000000UL / pcmRate);
+    hostSetAnalog(micWav);
+    fprintf(stderr, "%s: %zu échantillons à %u Hz\n", path, pcm.size(), pcmRate);
+  } else {
+    hostSetAnalog(micTone);
+    if (frames < 0) frames = 100;
+  }
+
+  hostUseVirtualClock();
+  hostOnShow(onShow);
+  ledsBegin();
+
+  ScenarioAudio sc;
+  sc.begin();
+  for (long f = 0; frames < 0 || f < frames; ++f) {
+    uint32_t now = millis();
+    if (now * 1000ULL >= endUs) break;
+    sc.tick(now);
+  }
+  sc.end();
+  return 0;
+}
@@ -0,0 +1,39 @@
+#!/bin/sh
+# Construit une image de banc par cas (USE_BENCH=1, BENCH_ONLY=1..n) pour ATmega2560 avec
+# arduino-cli, et affiche la RAM statique (.data + .bss) de chacune. Avec RUN=1, chaque image
+# est ensuite exécutée sous simavr (qui s'arrête au sommeil final de benchRun()).
+#
+#   host/bench_images.sh            -> images dans host/build/bench/bench_<n>.elf
+#   RUN=1 host/bench_images.sh
+#
+# Prérequis : arduino-cli avec le cœur arduino:avr et la bibliothèque FastLED, avr-size ;
+# simavr pour RUN=1.
+set -e
+cd "$(dirname "$0")"
+FQBN="${FQBN:-arduino:avr:mega}"
+MCU="${MCU:-atmega2560}"
+OUT="$PWD/build/bench"
+mkdir -p "$OUT"
+
+# arduino-cli exige un dossier de sketch portant le nom du .ino principal
+SKETCH="$OUT/main"
+rm -rf "$SKETCH"
+mkdir -p "$SKETCH"
+cp ../*.ino ../*.h ../*.cpp "$SKETCH/"
+
+CASES=$(grep -o 'BENCH_CASE([0-9]*)' ../Bench.cpp | sort -u | wc -l)
+
+printf "%-6s %8s\n" "cas" "ram"
+n=1
+while [ "$n" -le "$CASES" ]; do
+  arduino-cli compile --fqbn "$FQBN" --output-dir "$OUT/$n" \
+    --build-property "compiler.cpp.extra_flags=-DUSE_BENCH=1 -DBENCH_ONLY=$n" \
+    "$SKETCH" > "$OUT/$n.log" 2>&1 || { echo "cas $n : échec, voir $OUT/$n.log"; exit 1; }
+  cp "$OUT/$n/main.ino.elf" "$OUT/bench_$n.elf"
+  ram=$(avr-size -A "$OUT/bench_$n.elf" | awk '$1 == ".data" || $1 == ".bss" { s += $2 } END { print s }')
+  printf "%-6s %8s\n" "$n" "$ram"
+  if [ "${RUN:-0}" = 1 ]; then
+    simavr -m "$MCU" -f 16000000 "$OUT/bench_$n.elf"
+  fi
+  n=$((n + 1))
+done
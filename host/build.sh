@@ -0,0 +1,13 @@
+#!/bin/sh
+# Construit les outils hôte dans host/build/ : les sources du sketch sont compilées telles
+# quelles contre les substituts host/Arduino.h et host/FastLED.h.
+set -e
+cd "$(dirname "$0")"
+mkdir -p build
+CXX="${CXX:-g++}"
+FLAGS="-std=gnu++11 -O2 -Wall -Wextra -I. -I.."
+CORE="HostCore.cpp ../Leds.cpp"
+
+$CXX $FLAGS -o build/stream_pty stream_pty.cpp $CORE ../ScenarioStream.cpp
+$CXX $FLAGS -o build/audio_wav audio_wav.cpp $CORE ../ScenarioAudio.cpp ../HexGrid.cpp
+echo "host/build: $(ls build | tr '\n' ' ')"
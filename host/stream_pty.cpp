@@ -0,0 +1,58 @@
+// Pilote pty pour ScenarioStream : le scénario tourne sur l'hôte, branché sur un pseudo-terminal
+// que n'importe quel client Adalight (ou stream_send.py) ouvre comme un port série.
+//
+//   host/build/stream_pty            -> affiche le chemin du pty (/dev/pts/N)
+//   host/stream_send.py /dev/pts/N   -> envoie des trames, compte crédits et rejets
+//
+// Chaque seconde, stderr reçoit le nombre de show() et un aperçu des 8 premières LEDs.
+#include <Arduino.h>
+#include <FastLED.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#include "Host.h"
+#include "../Config.h"
+#include "../Leds.h"
+#include "../ScenarioStream.h"
+
+static uint32_t shows = 0;
+static void onShow(const CRGB*, int) { shows++; }
+
+int main() {
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) < 0 || unlockpt(master) < 0) { perror("pty"); return 1; }
+  const char* path = ptsname(master);
+
+  // côté esclave en mode brut (pas d'écho ni de traduction de fins de ligne), gardé ouvert
+  // pour que le maître ne voie pas EIO entre deux connexions du client
+  int slave = open(path, O_RDWR | O_NOCTTY);
+  termios tio;
+  tcgetattr(slave, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(slave, TCSANOW, &tio);
+
+  printf("%s\n", path);
+  fflush(stdout);
+
+  hostSerialAttach(master, master);
+  hostOnShow(onShow);
+  ledsBegin();
+
+  ScenarioStream sc;
+  sc.begin();
+  uint32_t reportAt = millis();
+  for (;;) {
+    uint32_t now = millis();
+    sc.tick(now);
+    if (now - reportAt >= 1000) {
+      fprintf(stderr, "show=%u  leds[0..7]:", shows);
+      for (int i = 0; i < 8; ++i) fprintf(stderr, " %02x%02x%02x", leds[i].r, leds[i].g, leds[i].b);
+      fprintf(stderr, "\n");
+      shows = 0;
+      reportAt = now;
+    }
+    usleep(100);
+  }
+}
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""Client de test pour ScenarioStream (carte ou host/build/stream_pty).
+
+Envoie des trames Adalight complètes ('Ada') ou partielles ('Adp') en respectant les
+crédits '+'/'!', peut en corrompre une partie, et vérifie que chaque trame envoyée
+rend bien son crédit (aucun blocage). Code de sortie 1 si le flux se bloque.
+
+  stream_send.py /dev/pts/N --frames 500 --partial --corrupt 0.1
+"""
+import argparse, os, random, select, sys, time, tty
+
+NUM_LEDS = 169
+SALT = 0x55
+
+
+def full_frame(rgb):
+    n = len(rgb) // 3 - 1
+    hi, lo = n >> 8, n & 0xFF
+    return bytes([ord('A'), ord('d'), ord('a'), hi, lo, hi ^ lo ^ SALT]) + rgb
+
+
+def partial_frame(off, rgb, show=True):
+    n = len(rgb) // 3
+    h = [off >> 8, off & 0xFF, n >> 8, n & 0xFF, 1 if show else 0]
+    chk = SALT
+    for b in h:
+        chk ^= b
+    return bytes([ord('A'), ord('d'), ord('p')] + h + [chk]) + rgb + bytes([sum(rgb) & 0xFF])
+
+
+def corrupt(frame, mode):
+    f = bytearray(frame)
+    if mode == 'magic':
+        f[0] = ord('X')                       # magic perdu : seul le timeout peut rendre le crédit
+    elif mode == 'sum':
+        f[-1] ^= 0xFF                         # somme fausse (trames partielles)
+    elif mode == 'truncate':
+        f = f[:len(f) // 2]                   # trame tronquée
+    return bytes(f)
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('port')
+    ap.add_argument('--frames', type=int, default=300)
+    ap.add_argument('--partial', action='store_true', help='fenêtres partielles au lieu de trames complètes')
+    ap.add_argument('--corrupt', type=float, default=0.0, help='proportion de trames corrompues')
+    ap.add_argument('--seed', type=int, default=1)
+    ap.add_argument('--stall', type=float, default=2.0, help='secondes sans crédit = blocage')
+    ap.add_argument('--window', type=int, default=1,
+                    help='crédits supposés si "Ada" ne vient pas (carte déjà démarrée, pas de reset DTR)')
+    a = ap.parse_args()
+    rnd = random.Random(a.seed)
+
+    fd = os.open(a.port, os.O_RDWR | os.O_NOCTTY)
+    tty.setraw(fd)
+
+    credits = sent = ok = drop = corrupted = reclaimed = 0
+    window = 0
+    buf = b''
+    last_credit = last_send = time.time()
+
+    def pump(timeout):
+        nonlocal buf, credits, ok, drop, last_credit, reclaimed
+        r, _, _ = select.select([fd], [], [], timeout)
+        if not r:
+            return
+        buf += os.read(fd, 4096)
+        while buf:
+            c = buf[:1]
+            if c in (b'#', b'A'):             # "#fps=.. drop=..\n" ou "Ada\n"
+                nl = buf.find(b'\n')
+                if nl < 0:
+                    return
+                line, buf = buf[:nl], buf[nl + 1:]
+                if c == b'#':
+                    print(line.decode(errors='replace'))
+                    # rien en vol côté LEDs et rien envoyé depuis : crédits perdus récupérés
+                    if b'idle=1' in line and window and time.time() - last_send > 0.3:
+                        lost = (sent - ok - drop - reclaimed)
+                        if lost > 0:
+                            reclaimed += lost
+                            credits += lost
+                            last_credit = time.time()
+                continue
+            buf = buf[1:]
+            if c == b'+':
+                credits += 1; ok += 1; last_credit = time.time()
+            elif c == b'!':
+                credits += 1; drop += 1; last_credit = time.time()
+
+    # crédits initiaux : STREAM_WINDOW '+' après "Ada\n" (non comptés comme trames) ; un pty
+    # garde ce que stream_pty a écrit avant l'ouverture, une carte le renvoie après son reset
+    deadline = time.time() + 1.0
+    while time.time() < deadline:
+        pump(0.05)
+    window = ok if ok else a.window
+    credits, ok = window, 0
+    last_credit = time.time()
+
+    while sent < a.frames:
+        if credits == 0:
+            if time.time() - last_credit > a.stall + 1.5:   # + une période de "#fps idle="
+                print(f'BLOQUÉ : sent={sent} ok={ok} drop={drop}', file=sys.stderr)
+                return 1
+            pump(0.05)
+            continue
+        t = sent * 4
+        if a.partial:
+            off = rnd.randrange(NUM_LEDS)
+            n = rnd.randint(1, NUM_LEDS - off)
+            frame = partial_frame(off, bytes((t + i) & 0xFF for i in range(3 * n)))
+        else:
+            frame = full_frame(bytes((t + i) & 0xFF for i in range(3 * NUM_LEDS)))
+        if rnd.random() < a.corrupt:
+            frame = corrupt(frame, rnd.choice(['magic', 'truncate'] + (['sum'] if a.partial else [])))
+            corrupted += 1
+        os.write(fd, frame)
+        last_send = time.time()
+        credits -= 1
+        sent += 1
+        pump(0)
+
+    deadline = time.time() + a.stall
+    while ok + drop + reclaimed < sent and time.time() < deadline:
+        pump(0.05)
+    print(f'sent={sent} corrupted={corrupted} ok={ok} drop={drop} reclaimed={reclaimed}')
+    return 0 if ok + drop + reclaimed == sent else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
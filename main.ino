@@ -7,17 +7,51 @@
 #include "ScenarioCloud.h"
 #include "ScenarioWaves.h"
 #include "ScenarioSmiley.h"
+#include "ScenarioFire.h"
+#include "ScenarioAudio.h"
+#include "Effects.h"
+#if USE_STREAM
+  #include "ScenarioStream.h"
+#endif
 #include "Background.h"
 #include "Button.h"
 
+#if USE_BENCH
+#include "Bench.h"
+
+void setup() { benchRun(); }
+void loop() {}
+
+#else
+
 static ScenarioCloud  scCloud;
 static ScenarioWaves  scWaves;
 static ScenarioSmiley scSmiley;
+static ScenarioFire   scFire;
+static ScenarioAudio  scAudio;
+static ScenarioEffect<FX_RIPPLES> scRipples;
+static ScenarioEffect<FX_COMETS>  scComets;
+#if USE_FX_PREVIEW
+  static ScenarioEffectPreview scPreview(FX_SPARKLE);
+#endif
+#if USE_STREAM
+  static ScenarioStream scStream;
+#endif
 
 static Scenario* scenarios[] = {
   &scCloud,
   &scWaves,
   &scSmiley,
+  &scFire,
+  &scRipples,
+  &scComets,
+  &scAudio,
+#if USE_FX_PREVIEW
+  &scPreview,
+#endif
+#if USE_STREAM
+  &scStream,
+#endif
 };
 static const uint8_t NUM_SCEN = sizeof(scenarios)/sizeof(scenarios[0]);
 static uint8_t curIdx = 0;
@@ -72,6 +106,7 @@ void loop() {
 
   // Mode scénarios : clique => suivant
   if (btn.clicked()) {
+    current->end();
     curIdx = (curIdx + 1) % NUM_SCEN;
     current = scenarios[curIdx];
     FastLED.clear(true);
@@ -82,3 +117,5 @@ void loop() {
   current->tick(now);
   // yield();
 }
+
+#endif